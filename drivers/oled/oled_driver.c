@@ -23,6 +23,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #        include "keyboard.h"
 #    endif
 #endif
+#if defined(SPLIT_OLED_BUFFER_ENABLE)
+#    include "keyboard.h"
+#endif
 
 #include "compiler_support.h"
 #include "oled_driver.h"
@@ -96,12 +99,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define SH1107_MEMORY_MODE_VERTICAL 0x21
 
 // Misc defines
-#ifndef OLED_BLOCK_COUNT
-#    define OLED_BLOCK_COUNT (sizeof(OLED_BLOCK_TYPE) * 8)
-#endif
-#ifndef OLED_BLOCK_SIZE
-#    define OLED_BLOCK_SIZE (OLED_MATRIX_SIZE / OLED_BLOCK_COUNT)
-#endif
+#define OLED_PAGE_COUNT (OLED_DISPLAY_HEIGHT / 8)
 // Default display clock
 #if !defined(OLED_DISPLAY_CLOCK)
 #    define OLED_DISPLAY_CLOCK 0x80
@@ -114,8 +112,6 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define OLED_PRE_CHARGE_PERIOD 0xF1
 #endif
 
-#define OLED_ALL_BLOCKS_MASK (((((OLED_BLOCK_TYPE)1 << (OLED_BLOCK_COUNT - 1)) - 1) << 1) | 1)
-
 #define OLED_IC_HAS_HORIZONTAL_MODE (OLED_IC == OLED_IC_SSD1306)
 #define OLED_IC_COM_PINS_ARE_COLUMNS (OLED_IC == OLED_IC_SH1107)
 
@@ -147,7 +143,6 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 // and also allows for drawing & inverting
 uint8_t         oled_buffer[OLED_MATRIX_SIZE];
 uint8_t        *oled_cursor;
-OLED_BLOCK_TYPE oled_dirty          = 0;
 bool            oled_initialized    = false;
 bool            oled_active         = false;
 bool            oled_scrolling      = false;
@@ -168,6 +163,37 @@ uint32_t oled_scroll_timeout;
 uint16_t oled_update_timeout;
 #endif
 
+// Range of columns in a page of display memory that still needs to be rendered, empty when first > last
+typedef struct {
+    uint8_t first;
+    uint8_t last;
+} oled_span_t;
+
+static oled_span_t oled_dirty_spans[OLED_PAGE_COUNT];
+static bool        oled_dirty = false;
+#if OLED_SHADOW_BUFFER
+// The buffer in display memory layout, kept up to date while rotated by 90 degrees
+static uint8_t oled_shadow_buffer[OLED_MATRIX_SIZE];
+#endif
+
+// The buffer the drawing functions write to
+static uint8_t *oled_target = oled_buffer;
+#if defined(SPLIT_OLED_BUFFER_ENABLE)
+// Tokens of the packed changes sent to the other half, followed by the length of the run minus one
+#    define OLED_SYNC_LITERAL 0x00 // that many bytes follow
+#    define OLED_SYNC_REPEAT 0x40  // the byte that follows is repeated
+#    define OLED_SYNC_SKIP 0x80    // bytes that have not changed
+#    define OLED_SYNC_RUN_MAX 64
+#    define OLED_SYNC_SKIP_MAX 128
+
+// What the master draws for the other half, what the other half has been sent of it so far, and which bytes it may
+// have lost since and have to be sent again whatever their value
+static uint8_t  oled_remote_buffer[OLED_MATRIX_SIZE];
+static uint8_t  oled_remote_sent[OLED_MATRIX_SIZE];
+static uint8_t  oled_remote_stale[(OLED_MATRIX_SIZE + 7) / 8];
+static uint8_t *oled_remote_cursor = oled_remote_buffer;
+#endif
+
 #if defined(OLED_TRANSPORT_SPI)
 #    ifndef OLED_DC_PIN
 #        error "The OLED driver in SPI needs a D/C pin defined"
@@ -187,9 +213,24 @@ uint16_t oled_update_timeout;
 #    endif
 #endif
 
+#if defined(OLED_TRANSPORT_SPI) && defined(OLED_SPI_ASYNC)
+static bool oled_transfer_pending = false;
+#endif
+
+// Waits for the render data transfer in flight, and releases the bus
+static void oled_wait(void) {
+#if defined(OLED_TRANSPORT_SPI) && defined(OLED_SPI_ASYNC)
+    if (oled_transfer_pending) {
+        spi_stop();
+        oled_transfer_pending = false;
+    }
+#endif
+}
+
 // Transmit/Write Funcs.
 __attribute__((weak)) bool oled_send_cmd(const uint8_t *data, uint16_t size) {
 #if defined(OLED_TRANSPORT_SPI)
+    oled_wait();
     if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
         return false;
     }
@@ -206,12 +247,16 @@ __attribute__((weak)) bool oled_send_cmd(const uint8_t *data, uint16_t size) {
     i2c_status_t status = i2c_transmit((OLED_DISPLAY_ADDRESS << 1), data, size, OLED_I2C_TIMEOUT);
 
     return (status == I2C_STATUS_SUCCESS);
+#else
+    // Custom transports replace this function
+    return false;
 #endif
 }
 
 __attribute__((weak)) bool oled_send_cmd_P(const uint8_t *data, uint16_t size) {
 #if defined(__AVR__)
 #    if defined(OLED_TRANSPORT_SPI)
+    oled_wait();
     if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
         return false;
     }
@@ -229,6 +274,9 @@ __attribute__((weak)) bool oled_send_cmd_P(const uint8_t *data, uint16_t size) {
     i2c_status_t status = i2c_transmit_P((OLED_DISPLAY_ADDRESS << 1), data, size, OLED_I2C_TIMEOUT);
 
     return (status == I2C_STATUS_SUCCESS);
+#    else
+    // Custom transports replace this function
+    return false;
 #    endif
 #else
     return oled_send_cmd(data, size);
@@ -237,6 +285,7 @@ __attribute__((weak)) bool oled_send_cmd_P(const uint8_t *data, uint16_t size) {
 
 __attribute__((weak)) bool oled_send_data(const uint8_t *data, uint16_t size) {
 #if defined(OLED_TRANSPORT_SPI)
+    oled_wait();
     if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
         return false;
     }
@@ -252,6 +301,31 @@ __attribute__((weak)) bool oled_send_data(const uint8_t *data, uint16_t size) {
 #elif defined(OLED_TRANSPORT_I2C)
     i2c_status_t status = i2c_write_register((OLED_DISPLAY_ADDRESS << 1), I2C_DATA, data, size, OLED_I2C_TIMEOUT);
     return (status == I2C_STATUS_SUCCESS);
+#else
+    // Custom transports replace this function
+    return false;
+#endif
+}
+
+// Sends render data, returning while it is still being transferred when possible.
+// The data has to stay in place until the next oled_wait(), so it is only ever taken straight from the buffers.
+static bool oled_send_data_async(const uint8_t *data, uint16_t size) {
+#if defined(OLED_TRANSPORT_SPI) && defined(OLED_SPI_ASYNC)
+    oled_wait();
+    if (!spi_start(OLED_CS_PIN, false, OLED_SPI_MODE, OLED_SPI_DIVISOR)) {
+        return false;
+    }
+    // Data Mode
+    gpio_write_pin_high(OLED_DC_PIN);
+    // Start sending the data, the bus is released by the next oled_wait()
+    if (spi_transmit_async(data, size) != SPI_STATUS_SUCCESS) {
+        spi_stop();
+        return false;
+    }
+    oled_transfer_pending = true;
+    return true;
+#else
+    return oled_send_data(data, size);
 #endif
 }
 
@@ -372,79 +446,107 @@ __attribute__((weak)) oled_rotation_t oled_init_user(oled_rotation_t rotation) {
     return rotation;
 }
 
-void oled_clear(void) {
-    memset(oled_buffer, 0, sizeof(oled_buffer));
-    oled_cursor = &oled_buffer[0];
-    oled_dirty  = OLED_ALL_BLOCKS_MASK;
-}
-
-static void calc_bounds(uint8_t update_start, uint8_t *cmd_array) {
-    // Calculate commands to set memory addressing bounds.
-    uint8_t start_page   = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_WIDTH;
-    uint8_t start_column = OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_WIDTH;
-#if !OLED_IC_HAS_HORIZONTAL_MODE
-    // Commands for Page Addressing Mode. Sets starting page and column; has no end bound.
-    // Column value must be split into high and low nybble and sent as two commands.
-    cmd_array[0] = PAM_PAGE_ADDR | start_page;
-    cmd_array[1] = PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + start_column) & 0x0f);
-    cmd_array[2] = PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + start_column) >> 4 & 0x0f);
-#else
-    // Commands for use in Horizontal Addressing mode.
-    cmd_array[1] = start_column + OLED_COLUMN_OFFSET;
-    cmd_array[4] = start_page;
-    cmd_array[2] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) % OLED_DISPLAY_WIDTH + cmd_array[1];
-    cmd_array[5] = (OLED_BLOCK_SIZE + OLED_DISPLAY_WIDTH - 1) / OLED_DISPLAY_WIDTH - 1 + cmd_array[4];
-#endif
+// Extends the dirty span of a page of display memory
+static void oled_mark_span_dirty(uint8_t page, uint8_t first, uint8_t last) {
+    oled_span_t *span = &oled_dirty_spans[page];
+    if (first < span->first) {
+        span->first = first;
+    }
+    if (last > span->last) {
+        span->last = last;
+    }
+    oled_dirty = true;
 }
 
-static void calc_bounds_90(uint8_t update_start, uint8_t *cmd_array) {
-    // Block numbering starts from the bottom left corner, going up and then to
-    // the right.  The controller needs the page and column numbers for the top
-    // left and bottom right corners of that block.
-
-    // Total number of pages across the screen height.
-    const uint8_t height_in_pages = OLED_DISPLAY_HEIGHT / 8;
-
-    // Difference of starting page numbers for adjacent blocks; may be 0 if
-    // blocks are large enough to occupy one or more whole 8px columns.
-    const uint8_t page_inc_per_block = OLED_BLOCK_SIZE % OLED_DISPLAY_HEIGHT / 8;
+// Marks a byte of the buffer as changed
+static void oled_mark_dirty(uint16_t index) {
+#if defined(SPLIT_OLED_BUFFER_ENABLE)
+    // Changes to the other half's buffer are found by comparing with what was sent
+    if (is_oled_remote()) {
+        return;
+    }
+#endif
+    if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        // The buffer has the same layout as display memory
+        uint8_t column = index % OLED_DISPLAY_WIDTH;
+        oled_mark_span_dirty(index / OLED_DISPLAY_WIDTH, column, column);
+        return;
+    }
 
-    // Top page number for a block which is at the bottom edge of the screen.
-    const uint8_t bottom_block_top_page = (height_in_pages - page_inc_per_block) % height_in_pages;
+    // Rotated by 90 degrees, the byte ends up as one bit of 8 consecutive columns in display memory
+    uint8_t row    = OLED_DISPLAY_HEIGHT - 1 - index % OLED_DISPLAY_HEIGHT;
+    uint8_t column = index / OLED_DISPLAY_HEIGHT * 8;
+#if OLED_SHADOW_BUFFER
+    uint8_t *target = &oled_shadow_buffer[row / 8 * OLED_DISPLAY_WIDTH + column];
+    uint8_t  mask   = 1 << (row % 8);
+    uint8_t  data   = oled_buffer[index];
+    for (uint8_t i = 0; i < 8; ++i, data >>= 1) {
+        target[i] = (data & 1) ? (target[i] | mask) : (target[i] & ~mask);
+    }
+#endif
+    oled_mark_span_dirty(row / 8, column, column + 7);
+}
 
-#if !OLED_IC_HAS_HORIZONTAL_MODE
-    // Only the Page Addressing Mode is supported
-    uint8_t start_page   = bottom_block_top_page - (OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_HEIGHT / 8);
-    uint8_t start_column = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_HEIGHT * 8;
-    cmd_array[0]         = PAM_PAGE_ADDR | start_page;
-    cmd_array[1]         = PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + start_column) & 0x0f);
-    cmd_array[2]         = PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + start_column) >> 4 & 0x0f);
-#else
-    cmd_array[1] = OLED_BLOCK_SIZE * update_start / OLED_DISPLAY_HEIGHT * 8 + OLED_COLUMN_OFFSET;
-    cmd_array[4] = bottom_block_top_page - (OLED_BLOCK_SIZE * update_start % OLED_DISPLAY_HEIGHT / 8);
-    cmd_array[2] = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8 - 1 + cmd_array[1];
-    cmd_array[5] = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) % OLED_DISPLAY_HEIGHT / 8 + cmd_array[4];
+// Marks the whole display as dirty, without changing the shadow buffer
+static void oled_mark_all_dirty(void) {
+#if defined(SPLIT_OLED_BUFFER_ENABLE)
+    if (is_oled_remote()) {
+        return;
+    }
 #endif
+    for (uint8_t page = 0; page < OLED_PAGE_COUNT; ++page) {
+        oled_dirty_spans[page] = (oled_span_t){.first = 0, .last = OLED_DISPLAY_WIDTH - 1};
+    }
+    oled_dirty = true;
 }
 
-uint8_t crot(uint8_t a, int8_t n) {
-    const uint8_t mask = 0x7;
-    n &= mask;
-    return a << n | a >> (-n & mask);
+void oled_clear(void) {
+    memset(oled_target, 0, OLED_MATRIX_SIZE);
+#if OLED_SHADOW_BUFFER
+    if (oled_target == oled_buffer) {
+        memset(oled_shadow_buffer, 0, sizeof(oled_shadow_buffer));
+    }
+#endif
+    oled_cursor = &oled_target[0];
+    oled_mark_all_dirty();
 }
 
-static void rotate_90(const uint8_t *src, uint8_t *dest) {
-    for (uint8_t i = 0, shift = 7; i < 8; ++i, --shift) {
-        uint8_t selector = (1 << i);
-        for (uint8_t j = 0; j < 8; ++j) {
-            dest[i] |= crot(src[j] & selector, shift - (int8_t)j);
+#if !OLED_SHADOW_BUFFER
+// Gathers a byte of display memory from the buffer while rotated by 90 degrees
+static uint8_t oled_rotated_byte(uint16_t index) {
+    uint8_t        page   = index / OLED_DISPLAY_WIDTH;
+    uint8_t        column = index % OLED_DISPLAY_WIDTH;
+    const uint8_t *source = &oled_buffer[column / 8 * OLED_DISPLAY_HEIGHT + OLED_DISPLAY_HEIGHT - 1 - page * 8];
+    uint8_t        mask   = 1 << (column % 8);
+    uint8_t        data   = 0;
+    for (uint8_t i = 0; i < 8; ++i) {
+        if (*(source - i) & mask) {
+            data |= 1 << i;
         }
     }
+    return data;
 }
+#endif
 
-void oled_render_dirty(bool all) {
+// Sends the display memory contents starting at the given index
+static bool oled_send_render_data(uint16_t start, uint16_t size) {
+    if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        return oled_send_data_async(&oled_buffer[start], size);
+    }
+#if OLED_SHADOW_BUFFER
+    return oled_send_data_async(&oled_shadow_buffer[start], size);
+#else
+    // Gathered into a temporary buffer, which is reused for the next chunk
+    static uint8_t temp_buffer[OLED_UPDATE_CHUNK_SIZE];
+    for (uint16_t i = 0; i < size; ++i) {
+        temp_buffer[i] = oled_rotated_byte(start + i);
+    }
+    return oled_send_data(temp_buffer, size);
+#endif
+}
+
+static void oled_render_spans(bool all) {
     // Do we have work to do?
-    oled_dirty &= OLED_ALL_BLOCKS_MASK;
     if (!oled_dirty || !oled_initialized || oled_scrolling) {
         return;
     }
@@ -452,82 +554,76 @@ void oled_render_dirty(bool all) {
     // Turn on display if it is off
     oled_on();
 
-    uint8_t update_start  = 0;
+    uint8_t page          = 0;
     uint8_t num_processed = 0;
-    while (oled_dirty && (num_processed++ < OLED_UPDATE_PROCESS_LIMIT || all)) { // render all dirty blocks (up to the configured limit)
-        // Find next dirty block
-        while (!(oled_dirty & ((OLED_BLOCK_TYPE)1 << update_start))) {
-            ++update_start;
+    while (num_processed++ < OLED_UPDATE_PROCESS_LIMIT || all) { // render dirty spans (up to the configured limit)
+        // Find next dirty page
+        while (page < OLED_PAGE_COUNT && oled_dirty_spans[page].first > oled_dirty_spans[page].last) {
+            ++page;
+        }
+        if (page == OLED_PAGE_COUNT) {
+            oled_dirty = false;
+            return;
+        }
+
+        oled_span_t *span       = &oled_dirty_spans[page];
+        uint8_t      first      = span->first;
+        uint8_t      last       = span->last;
+        uint8_t      page_count = 1;
+        if (last - first >= OLED_UPDATE_CHUNK_SIZE) {
+            last = first + OLED_UPDATE_CHUNK_SIZE - 1;
         }
+#if OLED_IC_HAS_HORIZONTAL_MODE
+        // Whole pages follow each other in display memory, so consecutive ones are sent together
+        if (first == 0 && last == OLED_DISPLAY_WIDTH - 1) {
+            while (page + page_count < OLED_PAGE_COUNT && (page_count + 1) * OLED_DISPLAY_WIDTH <= OLED_UPDATE_CHUNK_SIZE && span[page_count].first == 0 && span[page_count].last == OLED_DISPLAY_WIDTH - 1) {
+                ++page_count;
+            }
+        }
+#endif
 
         // Set column & page position
 #if OLED_IC_HAS_HORIZONTAL_MODE
-        static uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, 0, OLED_DISPLAY_WIDTH - 1, PAGE_ADDR, 0, OLED_DISPLAY_HEIGHT / 8 - 1};
+        uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, OLED_COLUMN_OFFSET + first, OLED_COLUMN_OFFSET + last, PAGE_ADDR, page, page + page_count - 1};
 #else
-        static uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR, PAM_SETCOLUMN_LSB, PAM_SETCOLUMN_MSB};
+        // Page Addressing Mode sets the starting page and column, and has no end bound.
+        // The column value is split into high and low nybble and sent as two commands.
+        uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR | page, PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + first) & 0x0f), PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + first) >> 4 & 0x0f)};
 #endif
-        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            calc_bounds(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
-        } else {
-            calc_bounds_90(update_start, &display_start[1]); // Offset from I2C_CMD byte at the start
-        }
-
-        // Send column & page position
         if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
             print("oled_render offset command failed\n");
             return;
         }
 
-        if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
-            // Send render data chunk as is
-            if (!oled_send_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
-                print("oled_render data failed\n");
-                return;
-            }
-        } else {
-            // Rotate the render chunks
-            const static uint8_t source_map[] = OLED_SOURCE_MAP;
-            const static uint8_t target_map[] = OLED_TARGET_MAP;
-
-            static uint8_t temp_buffer[OLED_BLOCK_SIZE];
-            memset(temp_buffer, 0, sizeof(temp_buffer));
-            for (uint8_t i = 0; i < sizeof(source_map); ++i) {
-                rotate_90(&oled_buffer[OLED_BLOCK_SIZE * update_start + source_map[i]], &temp_buffer[target_map[i]]);
-            }
+        // Send render data, which may still be in flight while the next span is prepared
+        uint16_t start = page * OLED_DISPLAY_WIDTH + first;
+        uint16_t size  = (page_count - 1) * OLED_DISPLAY_WIDTH + last - first + 1;
+        if (!oled_send_render_data(start, size)) {
+            print("oled_render data failed\n");
+            return;
+        }
 
-#if OLED_IC_HAS_HORIZONTAL_MODE
-            // Send render data chunk after rotating
-            if (!oled_send_data(&temp_buffer[0], OLED_BLOCK_SIZE)) {
-                print("oled_render90 data failed\n");
-                return;
-            }
-#else
-            // For SH1106 or SH1107 the data chunk must be split into separate pieces for each page
-            const uint8_t columns_in_block = (OLED_BLOCK_SIZE + OLED_DISPLAY_HEIGHT - 1) / OLED_DISPLAY_HEIGHT * 8;
-            const uint8_t num_pages        = OLED_BLOCK_SIZE / columns_in_block;
-            for (uint8_t i = 0; i < num_pages; ++i) {
-                // Send column & page position for all pages except the first one
-                if (i > 0) {
-                    display_start[1]++;
-                    if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
-                        print("oled_render offset command failed\n");
-                        return;
-                    }
-                }
-                // Send data for the page
-                if (!oled_send_data(&temp_buffer[columns_in_block * i], columns_in_block)) {
-                    print("oled_render90 data failed\n");
-                    return;
-                }
+        // Shrink the dirty spans by what was just rendered
+        if (last < span->last) {
+            span->first = last + 1;
+        } else {
+            for (uint8_t i = 0; i < page_count; ++i) {
+                span[i] = (oled_span_t){.first = UINT8_MAX, .last = 0};
             }
-#endif
         }
-
-        // Clear dirty flag of just rendered block
-        oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
     }
 }
 
+void oled_render_dirty(bool all) {
+    oled_render_spans(all);
+    // Never return with the bus held, other SPI devices may be used before the next render
+    oled_wait();
+}
+
+bool oled_is_dirty(void) {
+    return oled_dirty;
+}
+
 void oled_set_cursor(uint8_t col, uint8_t line) {
     uint16_t index = line * oled_rotation_width + col * OLED_FONT_WIDTH;
 
@@ -536,11 +632,11 @@ void oled_set_cursor(uint8_t col, uint8_t line) {
         index = 0;
     }
 
-    oled_cursor = &oled_buffer[index];
+    oled_cursor = &oled_target[index];
 }
 
 void oled_advance_page(bool clearPageRemainder) {
-    uint16_t index     = oled_cursor - &oled_buffer[0];
+    uint16_t index     = oled_cursor - &oled_target[0];
     uint8_t  remaining = oled_rotation_width - (index % oled_rotation_width);
 
     if (clearPageRemainder) {
@@ -557,12 +653,12 @@ void oled_advance_page(bool clearPageRemainder) {
             remaining = 0;
         }
 
-        oled_cursor = &oled_buffer[index + remaining];
+        oled_cursor = &oled_target[index + remaining];
     }
 }
 
 void oled_advance_char(void) {
-    uint16_t nextIndex      = oled_cursor - &oled_buffer[0] + OLED_FONT_WIDTH;
+    uint16_t nextIndex      = oled_cursor - &oled_target[0] + OLED_FONT_WIDTH;
     uint8_t  remainingSpace = oled_rotation_width - (nextIndex % oled_rotation_width);
 
     // Do we have enough space on the current line for the next character
@@ -576,7 +672,7 @@ void oled_advance_char(void) {
     }
 
     // Update cursor position
-    oled_cursor = &oled_buffer[nextIndex];
+    oled_cursor = &oled_target[nextIndex];
 }
 
 // Main handler that writes character data to the display buffer
@@ -614,11 +710,11 @@ void oled_write_char(const char data, bool invert) {
     }
 
     // Dirty check
-    if (memcmp(&oled_temp_buffer, oled_cursor, OLED_FONT_WIDTH)) {
-        uint16_t index = oled_cursor - &oled_buffer[0];
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
-        // Edgecase check if the written data spans the 2 chunks
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << ((index + OLED_FONT_WIDTH - 1) / OLED_BLOCK_SIZE));
+    uint16_t index = oled_cursor - &oled_target[0];
+    for (uint8_t i = 0; i < OLED_FONT_WIDTH; i++) {
+        if (oled_temp_buffer[i] != oled_cursor[i]) {
+            oled_mark_dirty(index + i);
+        }
     }
 
     // Finally move to the next char
@@ -644,41 +740,48 @@ void oled_pan(bool left) {
         if (left) {
             for (uint16_t x = 0; x < OLED_DISPLAY_WIDTH - 1; x++) {
                 i              = y * OLED_DISPLAY_WIDTH + x;
-                oled_buffer[i] = oled_buffer[i + 1];
+                oled_target[i] = oled_target[i + 1];
             }
         } else {
             for (uint16_t x = OLED_DISPLAY_WIDTH - 1; x > 0; x--) {
                 i              = y * OLED_DISPLAY_WIDTH + x;
-                oled_buffer[i] = oled_buffer[i - 1];
+                oled_target[i] = oled_target[i - 1];
             }
         }
     }
-    oled_dirty = OLED_ALL_BLOCKS_MASK;
+#if OLED_SHADOW_BUFFER
+    if (HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        for (i = 0; i < OLED_MATRIX_SIZE; i++) {
+            oled_mark_dirty(i);
+        }
+    }
+#endif
+    oled_mark_all_dirty();
 }
 
 oled_buffer_reader_t oled_read_raw(uint16_t start_index) {
     if (start_index > OLED_MATRIX_SIZE) start_index = OLED_MATRIX_SIZE;
     oled_buffer_reader_t ret_reader;
-    ret_reader.current_element         = &oled_buffer[start_index];
+    ret_reader.current_element         = &oled_target[start_index];
     ret_reader.remaining_element_count = OLED_MATRIX_SIZE - start_index;
     return ret_reader;
 }
 
 void oled_write_raw_byte(const char data, uint16_t index) {
-    if (index > OLED_MATRIX_SIZE) index = OLED_MATRIX_SIZE;
-    if (oled_buffer[index] == data) return;
-    oled_buffer[index] = data;
-    oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+    if (index >= OLED_MATRIX_SIZE) return;
+    if (oled_target[index] == (uint8_t)data) return;
+    oled_target[index] = data;
+    oled_mark_dirty(index);
 }
 
 void oled_write_raw(const char *data, uint16_t size) {
-    uint16_t cursor_start_index = oled_cursor - &oled_buffer[0];
+    uint16_t cursor_start_index = oled_cursor - &oled_target[0];
     if ((size + cursor_start_index) > OLED_MATRIX_SIZE) size = OLED_MATRIX_SIZE - cursor_start_index;
     for (uint16_t i = cursor_start_index; i < cursor_start_index + size; i++) {
         uint8_t c = *data++;
-        if (oled_buffer[i] == c) continue;
-        oled_buffer[i] = c;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+        if (oled_target[i] == c) continue;
+        oled_target[i] = c;
+        oled_mark_dirty(i);
     }
 }
 
@@ -690,15 +793,15 @@ void oled_write_pixel(uint8_t x, uint8_t y, bool on) {
     if (index >= OLED_MATRIX_SIZE) {
         return;
     }
-    uint8_t data = oled_buffer[index];
+    uint8_t data = oled_target[index];
     if (on) {
         data |= (1 << (y % 8));
     } else {
         data &= ~(1 << (y % 8));
     }
-    if (oled_buffer[index] != data) {
-        oled_buffer[index] = data;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+    if (oled_target[index] != data) {
+        oled_target[index] = data;
+        oled_mark_dirty(index);
     }
 }
 
@@ -717,13 +820,13 @@ void oled_write_ln_P(const char *data, bool invert) {
 }
 
 void oled_write_raw_P(const char *data, uint16_t size) {
-    uint16_t cursor_start_index = oled_cursor - &oled_buffer[0];
+    uint16_t cursor_start_index = oled_cursor - &oled_target[0];
     if ((size + cursor_start_index) > OLED_MATRIX_SIZE) size = OLED_MATRIX_SIZE - cursor_start_index;
     for (uint16_t i = cursor_start_index; i < cursor_start_index + size; i++) {
         uint8_t c = pgm_read_byte(data++);
-        if (oled_buffer[i] == c) continue;
-        oled_buffer[i] = c;
-        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+        if (oled_target[i] == c) continue;
+        oled_target[i] = c;
+        oled_mark_dirty(i);
     }
 }
 #endif // defined(__AVR__)
@@ -873,7 +976,7 @@ bool oled_scroll_off(void) {
             return oled_scrolling;
         }
         oled_scrolling = false;
-        oled_dirty     = OLED_ALL_BLOCKS_MASK;
+        oled_mark_all_dirty();
     }
     return !oled_scrolling;
 }
@@ -920,6 +1023,142 @@ uint8_t oled_max_lines(void) {
     return OLED_DISPLAY_WIDTH / OLED_FONT_HEIGHT;
 }
 
+#if defined(SPLIT_OLED_BUFFER_ENABLE)
+bool is_oled_remote(void) {
+    return oled_target == oled_remote_buffer;
+}
+
+// Points the drawing functions at the buffer of this half or of the other half
+static void oled_select_remote(bool remote) {
+    if (remote == is_oled_remote()) {
+        return;
+    }
+    uint8_t *cursor    = oled_cursor;
+    oled_cursor        = oled_remote_cursor;
+    oled_remote_cursor = cursor;
+    oled_target        = remote ? oled_remote_buffer : oled_buffer;
+}
+
+void oled_buffer_sync_reset(void) {
+    memset(oled_remote_stale, 0xFF, sizeof(oled_remote_stale));
+}
+
+// Whether the other half doesn't have the byte at index yet
+static bool oled_remote_unsent(uint16_t index) {
+    return (oled_remote_stale[index / 8] & (1 << (index % 8))) || oled_remote_buffer[index] != oled_remote_sent[index];
+}
+
+// Records that the other half has been sent count bytes from index on
+static void oled_remote_mark_sent(uint16_t index, uint8_t count) {
+    memcpy(&oled_remote_sent[index], &oled_remote_buffer[index], count);
+    for (uint16_t i = index; i < index + count; i++) {
+        oled_remote_stale[i / 8] &= ~(1 << (i % 8));
+    }
+}
+
+// Number of bytes from index on that have not been sent, and all have the same value
+static uint8_t oled_remote_repeat(uint16_t index, uint8_t limit) {
+    uint8_t count = 0;
+    while (index + count < OLED_MATRIX_SIZE && count < limit && oled_remote_unsent(index + count) && oled_remote_buffer[index + count] == oled_remote_buffer[index]) {
+        count++;
+    }
+    return count;
+}
+
+uint8_t oled_buffer_sync_pack(uint16_t *offset, uint8_t *data, uint8_t size) {
+    uint16_t index = 0;
+    while (index < OLED_MATRIX_SIZE && !oled_remote_unsent(index)) {
+        index++;
+    }
+    if (index == OLED_MATRIX_SIZE) {
+        return 0;
+    }
+
+    *offset        = index;
+    uint8_t length = 0;
+    while (index < OLED_MATRIX_SIZE && length + 2 <= size) {
+        uint8_t count = 0;
+        if (!oled_remote_unsent(index)) {
+            // Skip over bytes the other half already has, as long as something after them still fits in the packet
+            uint16_t next = index;
+            while (next < OLED_MATRIX_SIZE && !oled_remote_unsent(next)) {
+                next++;
+            }
+            if (next == OLED_MATRIX_SIZE || length + 3 > size) {
+                break;
+            }
+            count          = next - index > OLED_SYNC_SKIP_MAX ? OLED_SYNC_SKIP_MAX : next - index;
+            data[length++] = OLED_SYNC_SKIP | (count - 1);
+            index += count;
+            continue;
+        }
+
+        count = oled_remote_repeat(index, OLED_SYNC_RUN_MAX);
+        if (count >= 3) {
+            // Run of the same value
+            data[length++] = OLED_SYNC_REPEAT | (count - 1);
+            data[length++] = oled_remote_buffer[index];
+        } else {
+            // Literal bytes, up to the next byte that is unchanged or starts a run
+            count = 0;
+            while (index + count < OLED_MATRIX_SIZE && count < OLED_SYNC_RUN_MAX && length + 1 + count < size && oled_remote_unsent(index + count) && (count == 0 || oled_remote_repeat(index + count, 3) < 3)) {
+                count++;
+            }
+            data[length++] = OLED_SYNC_LITERAL | (count - 1);
+            memcpy(&data[length], &oled_remote_buffer[index], count);
+            length += count;
+        }
+        oled_remote_mark_sent(index, count);
+        index += count;
+    }
+    return length;
+}
+
+void oled_buffer_sync_unpack(uint16_t offset, const uint8_t *data, uint8_t length) {
+    const uint8_t *end = data + length;
+    while (data < end && offset < OLED_MATRIX_SIZE) {
+        uint8_t token = *data++;
+        if ((token & OLED_SYNC_SKIP) == OLED_SYNC_SKIP) {
+            offset += (token & (OLED_SYNC_SKIP_MAX - 1)) + 1;
+            continue;
+        }
+
+        uint8_t count = (token & (OLED_SYNC_RUN_MAX - 1)) + 1;
+        if ((token & OLED_SYNC_REPEAT) == OLED_SYNC_REPEAT) {
+            if (data == end) {
+                return;
+            }
+            uint8_t value = *data++;
+            while (count-- && offset < OLED_MATRIX_SIZE) {
+                oled_write_raw_byte(value, offset++);
+            }
+        } else {
+            while (count-- && data < end && offset < OLED_MATRIX_SIZE) {
+                oled_write_raw_byte(*data++, offset++);
+            }
+        }
+    }
+}
+#endif // defined(SPLIT_OLED_BUFFER_ENABLE)
+
+// Lets the keyboard and user draw, on the master for both halves
+static void oled_task_draw(void) {
+#if defined(SPLIT_OLED_BUFFER_ENABLE)
+    // The other half's display is drawn by the master
+    if (!is_keyboard_master()) {
+        return;
+    }
+#endif
+    oled_set_cursor(0, 0);
+    oled_task_kb();
+#if defined(SPLIT_OLED_BUFFER_ENABLE)
+    oled_select_remote(true);
+    oled_set_cursor(0, 0);
+    oled_task_kb();
+    oled_select_remote(false);
+#endif
+}
+
 void oled_task(void) {
     if (!oled_initialized) {
         return;
@@ -928,12 +1167,10 @@ void oled_task(void) {
 #if OLED_UPDATE_INTERVAL > 0
     if (timer_elapsed(oled_update_timeout) >= OLED_UPDATE_INTERVAL) {
         oled_update_timeout = timer_read();
-        oled_set_cursor(0, 0);
-        oled_task_kb();
+        oled_task_draw();
     }
 #else
-    oled_set_cursor(0, 0);
-    oled_task_kb();
+    oled_task_draw();
 #endif
 
 #if OLED_SCROLL_TIMEOUT > 0
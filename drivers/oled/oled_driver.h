@@ -37,37 +37,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    ifndef OLED_MATRIX_SIZE
 #        define OLED_MATRIX_SIZE (OLED_DISPLAY_HEIGHT / 8 * OLED_DISPLAY_WIDTH) // 1024 (compile time mathed)
 #    endif
-#    ifndef OLED_BLOCK_TYPE
-#        define OLED_BLOCK_TYPE uint16_t
-#    endif
-#    ifndef OLED_BLOCK_COUNT
-#        define OLED_BLOCK_COUNT (sizeof(OLED_BLOCK_TYPE) * 8) // 32 (compile time mathed)
-#    endif
-#    ifndef OLED_BLOCK_SIZE
-#        define OLED_BLOCK_SIZE (OLED_MATRIX_SIZE / OLED_BLOCK_COUNT) // 32 (compile time mathed)
-#    endif
 #    ifndef OLED_COM_PINS
 #        define OLED_COM_PINS COM_PINS_ALT
 #    endif
 
-// For 90 degree rotation, we map our internal matrix to oled matrix using fixed arrays
-// The OLED writes to it's memory horizontally, starting top left, but our memory starts bottom left in this mode
-#    ifndef OLED_SOURCE_MAP
-#        define OLED_SOURCE_MAP {0, 8, 16, 24, 32, 40, 48, 56}
-#    endif
-#    ifndef OLED_TARGET_MAP
-#        define OLED_TARGET_MAP {56, 48, 40, 32, 24, 16, 8, 0}
-#    endif
-// If OLED_BLOCK_TYPE is uint32_t, these tables would look like:
-// #define OLED_SOURCE_MAP { 32, 40, 48, 56 }
-// #define OLED_TARGET_MAP { 24, 16, 8, 0 }
-// If OLED_BLOCK_TYPE is uint16_t, these tables would look like:
-// #define OLED_SOURCE_MAP { 0, 8, 16, 24, 32, 40, 48, 56 }
-// #define OLED_TARGET_MAP { 56, 48, 40, 32, 24, 16, 8, 0 }
-// If OLED_BLOCK_TYPE is uint8_t, these tables would look like:
-// #define OLED_SOURCE_MAP { 0, 8, 16, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120 }
-// #define OLED_TARGET_MAP { 56, 120, 48, 112, 40, 104, 32, 96, 24, 88, 16, 80, 8, 72, 0, 64 }
-
 #elif defined(OLED_DISPLAY_64X32)
 #    ifndef OLED_DISPLAY_WIDTH
 #        define OLED_DISPLAY_WIDTH 64
@@ -81,26 +54,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    ifndef OLED_MATRIX_SIZE
 #        define OLED_MATRIX_SIZE (OLED_DISPLAY_HEIGHT / 8 * OLED_DISPLAY_WIDTH)
 #    endif
-#    ifndef OLED_BLOCK_TYPE
-#        define OLED_BLOCK_TYPE uint8_t
-#    endif
-#    ifndef OLED_BLOCK_COUNT
-#        define OLED_BLOCK_COUNT (sizeof(OLED_BLOCK_TYPE) * 8) // 8 (compile time mathed)
-#    endif
-#    ifndef OLED_BLOCK_SIZE
-#        define OLED_BLOCK_SIZE (OLED_MATRIX_SIZE / OLED_BLOCK_COUNT) // 32 (compile time mathed)
-#    endif
 #    ifndef OLED_COM_PINS
 #        define OLED_COM_PINS COM_PINS_ALT
 #    endif
 
-#    ifndef OLED_SOURCE_MAP
-#        define OLED_SOURCE_MAP {0, 8, 16, 24}
-#    endif
-#    ifndef OLED_TARGET_MAP
-#        define OLED_TARGET_MAP {24, 16, 8, 0}
-#    endif
-
 #elif defined(OLED_DISPLAY_64X48)
 #    ifndef OLED_DISPLAY_WIDTH
 #        define OLED_DISPLAY_WIDTH 64
@@ -114,26 +71,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    ifndef OLED_MATRIX_SIZE
 #        define OLED_MATRIX_SIZE (OLED_DISPLAY_HEIGHT / 8 * OLED_DISPLAY_WIDTH)
 #    endif
-#    ifndef OLED_BLOCK_TYPE
-#        define OLED_BLOCK_TYPE uint32_t
-#    endif
-#    ifndef OLED_BLOCK_COUNT
-#        define OLED_BLOCK_COUNT 24
-#    endif
-#    ifndef OLED_BLOCK_SIZE
-#        define OLED_BLOCK_SIZE (OLED_MATRIX_SIZE / OLED_BLOCK_COUNT)
-#    endif
 #    ifndef OLED_COM_PINS
 #        define OLED_COM_PINS COM_PINS_ALT
 #    endif
 
-#    ifndef OLED_SOURCE_MAP
-#        define OLED_SOURCE_MAP {0, 8}
-#    endif
-#    ifndef OLED_TARGET_MAP
-#        define OLED_TARGET_MAP {8, 0}
-#    endif
-
 #elif defined(OLED_DISPLAY_64X128)
 #    ifndef OLED_DISPLAY_WIDTH
 #        define OLED_DISPLAY_WIDTH 64
@@ -150,26 +91,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    ifndef OLED_MATRIX_SIZE
 #        define OLED_MATRIX_SIZE (OLED_DISPLAY_HEIGHT / 8 * OLED_DISPLAY_WIDTH)
 #    endif
-#    ifndef OLED_BLOCK_TYPE
-#        define OLED_BLOCK_TYPE uint16_t
-#    endif
-#    ifndef OLED_BLOCK_COUNT
-#        define OLED_BLOCK_COUNT (sizeof(OLED_BLOCK_TYPE) * 8)
-#    endif
-#    ifndef OLED_BLOCK_SIZE
-#        define OLED_BLOCK_SIZE (OLED_MATRIX_SIZE / OLED_BLOCK_COUNT)
-#    endif
 #    ifndef OLED_COM_PINS
 #        define OLED_COM_PINS COM_PINS_ALT
 #    endif
 
-#    ifndef OLED_SOURCE_MAP
-#        define OLED_SOURCE_MAP {0, 8, 16, 24, 32, 40, 48, 56}
-#    endif
-#    ifndef OLED_TARGET_MAP
-#        define OLED_TARGET_MAP {56, 48, 40, 32, 24, 16, 8, 0}
-#    endif
-
 #elif defined(OLED_DISPLAY_128X128)
 // Quad height 128x128
 #    ifndef OLED_DISPLAY_WIDTH
@@ -184,27 +109,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    ifndef OLED_MATRIX_SIZE
 #        define OLED_MATRIX_SIZE (OLED_DISPLAY_HEIGHT / 8 * OLED_DISPLAY_WIDTH) // 2048 (compile time mathed)
 #    endif
-#    ifndef OLED_BLOCK_TYPE
-#        define OLED_BLOCK_TYPE uint32_t
-#    endif
-#    ifndef OLED_BLOCK_COUNT
-#        define OLED_BLOCK_COUNT (sizeof(OLED_BLOCK_TYPE) * 8) // 32 (compile time mathed)
-#    endif
-#    ifndef OLED_BLOCK_SIZE
-#        define OLED_BLOCK_SIZE (OLED_MATRIX_SIZE / OLED_BLOCK_COUNT) // 64 (compile time mathed)
-#    endif
 #    ifndef OLED_COM_PINS
 #        define OLED_COM_PINS COM_PINS_ALT
 #    endif
 
-// For 90 degree rotation, we map our internal matrix to oled matrix using fixed arrays
-// The OLED writes to it's memory horizontally, starting top left, but our memory starts bottom left in this mode
-#    ifndef OLED_SOURCE_MAP
-#        define OLED_SOURCE_MAP {0, 8, 16, 24, 32, 40, 48, 56}
-#    endif
-#    ifndef OLED_TARGET_MAP
-#        define OLED_TARGET_MAP {56, 48, 40, 32, 24, 16, 8, 0}
-#    endif
 #else // defined(OLED_DISPLAY_128X64)
 // Default 128x32
 #    ifndef OLED_DISPLAY_WIDTH
@@ -216,30 +124,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    ifndef OLED_MATRIX_SIZE
 #        define OLED_MATRIX_SIZE (OLED_DISPLAY_HEIGHT / 8 * OLED_DISPLAY_WIDTH) // 512 (compile time mathed)
 #    endif
-#    ifndef OLED_BLOCK_TYPE
-#        define OLED_BLOCK_TYPE uint16_t // Type to use for segmenting the oled display for smart rendering, use unsigned types only
-#    endif
-#    ifndef OLED_BLOCK_COUNT
-#        define OLED_BLOCK_COUNT (sizeof(OLED_BLOCK_TYPE) * 8) // 16 (compile time mathed)
-#    endif
-#    ifndef OLED_BLOCK_SIZE
-#        define OLED_BLOCK_SIZE (OLED_MATRIX_SIZE / OLED_BLOCK_COUNT) // 32 (compile time mathed)
-#    endif
 #    ifndef OLED_COM_PINS
 #        define OLED_COM_PINS COM_PINS_SEQ
 #    endif
-
-// For 90 degree rotation, we map our internal matrix to oled matrix using fixed arrays
-// The OLED writes to it's memory horizontally, starting top left, but our memory starts bottom left in this mode
-#    ifndef OLED_SOURCE_MAP
-#        define OLED_SOURCE_MAP {0, 8, 16, 24}
-#    endif
-#    ifndef OLED_TARGET_MAP
-#        define OLED_TARGET_MAP {24, 16, 8, 0}
-#    endif
-// If OLED_BLOCK_TYPE is uint8_t, these tables would look like:
-// #define OLED_SOURCE_MAP { 0, 8, 16, 24, 32, 40, 48, 56 }
-// #define OLED_TARGET_MAP { 48, 32, 16, 0, 56, 40, 24, 8 }
 #endif // defined(OLED_DISPLAY_CUSTOM)
 
 #if !defined(OLED_IC)
@@ -309,6 +196,20 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define OLED_UPDATE_PROCESS_LIMIT 1
 #endif
 
+// Largest number of bytes sent to the display in one transfer while rendering
+#if !defined(OLED_UPDATE_CHUNK_SIZE)
+#    define OLED_UPDATE_CHUNK_SIZE (OLED_MATRIX_SIZE / 16)
+#endif
+
+// Keeps a second copy of the buffer in display memory layout, so 90 degree rotation is done while drawing instead of while rendering
+#if !defined(OLED_SHADOW_BUFFER)
+#    if defined(__AVR__)
+#        define OLED_SHADOW_BUFFER 0
+#    else
+#        define OLED_SHADOW_BUFFER 1
+#    endif
+#endif
+
 typedef struct __attribute__((__packed__)) {
     uint8_t *current_element;
     uint16_t remaining_element_count;
@@ -344,10 +245,13 @@ void oled_clear(void);
 // Alias to oled_render_dirty to avoid a change in api.
 #define oled_render() oled_render_dirty(false)
 
-// Renders all dirty blocks to the display at one time or a subset depending on the value of
+// Renders all dirty areas to the display at one time or a subset depending on the value of
 // all.
 void oled_render_dirty(bool all);
 
+// Returns true if parts of the buffer have not been rendered to the display yet
+bool oled_is_dirty(void);
+
 // Moves cursor to character position indicated by column and line, wraps if out of bounds
 // Max column denoted by 'oled_max_chars()' and max lines by 'oled_max_lines()' functions
 void oled_set_cursor(uint8_t col, uint8_t line);
@@ -477,3 +381,18 @@ uint8_t oled_max_chars(void);
 
 // Returns the maximum number of lines that will fit on the oled
 uint8_t oled_max_lines(void);
+
+#if defined(SPLIT_OLED_BUFFER_ENABLE)
+// Returns true while oled_task_kb and oled_task_user are drawing the display of the other half
+bool is_oled_remote(void);
+
+// Packs the changes to the other half's buffer since the last call into data, at most size bytes
+// Returns the number of bytes used, 0 if there are no changes
+uint8_t oled_buffer_sync_pack(uint16_t *offset, uint8_t *data, uint8_t size);
+
+// Applies changes packed by oled_buffer_sync_pack to the buffer
+void oled_buffer_sync_unpack(uint16_t offset, const uint8_t *data, uint8_t length);
+
+// Makes the next calls to oled_buffer_sync_pack send the whole buffer
+void oled_buffer_sync_reset(void);
+#endif
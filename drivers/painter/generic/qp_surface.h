@@ -60,9 +60,27 @@ painter_device_t qp_make_mono1bpp_surface(uint16_t panel_width, uint16_t panel_h
  */
 painter_device_t qp_make_rgb888_surface(uint16_t panel_width, uint16_t panel_height, void *buffer);
 
+/**
+ * Factory method for a palette-indexed surface (aka framebuffer).
+ *
+ * Colors drawn to the surface are stored as the index of the closest color in the palette, and expanded to the native
+ * pixel format of the target device by qp_surface_draw(). An 8bpp surface requires QUANTUM_PAINTER_SUPPORTS_256_PALETTE.
+ *
+ * @param panel_width[in] the width of the display panel
+ * @param panel_height[in] the height of the display panel
+ * @param bits_per_pixel[in] the size of each palette index, one of 1, 2, 4 or 8
+ * @param palette[in] pointer to `(1 << bits_per_pixel)` colors, which must remain valid for the lifetime of the surface
+ * @param buffer[in] pointer to a preallocated uint8_t buffer of size `SURFACE_REQUIRED_BUFFER_BYTE_SIZE(panel_width, panel_height, bits_per_pixel)`
+ * @return the device handle used with all drawing routines in Quantum Painter
+ */
+painter_device_t qp_make_palette_surface(uint16_t panel_width, uint16_t panel_height, uint8_t bits_per_pixel, const hsv_t *palette, void *buffer);
+
 /**
  * Helper method to draw the contents of the framebuffer to the target device.
  *
+ * RGB565 and RGB888 surfaces require a target with the same native pixel format. Monochrome and palette-indexed
+ * surfaces can be drawn to any target, their pixels are converted to the target's native format while being sent.
+ *
  * After successful completion, the dirty area is reset.
  *
  * @param surface[in] the surface to copy from
@@ -102,6 +102,108 @@ bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, u
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Palette expansion for monochrome and palette-indexed surfaces
+
+// Number of palette indices gathered before handing them to the target, a multiple of the pixels per byte of every supported bpp
+#define SURFACE_TRANSFER_BLOCK_PIXELS 64
+
+// Sends the surface's palette indices to the target, expanded to its native format. A NULL palette means black and white.
+bool qp_surface_indexed_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface, const hsv_t *palette) {
+    surface_painter_device_t *surface_handle  = (surface_painter_device_t *)surface_driver;
+    const uint8_t             bpp             = surface_driver->native_bits_per_pixel;
+    const uint16_t            palette_size    = 1 << bpp;
+    const uint8_t             pixels_per_byte = 8 / bpp;
+    const uint8_t             index_mask      = palette_size - 1;
+
+    if (palette_size > sizeof(qp_internal_global_pixel_lookup_table) / sizeof(qp_pixel_t)) {
+        qp_dprintf("qp_surface_indexed_pixdata_transfer: fail (palette size %d larger than the lookup table)\n", (int)palette_size);
+        return false;
+    }
+
+    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
+    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
+    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
+    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
+
+    // Convert the whole palette to the target's native format up front, so each pixel is then only a table lookup
+    qp_pixel_t *lookup = qp_internal_global_pixel_lookup_table;
+    for (uint16_t i = 0; i < palette_size; ++i) {
+        if (palette) {
+            lookup[i].hsv888 = palette[i];
+        } else {
+            lookup[i].hsv888 = (hsv_t){.h = 0, .s = 0, .v = i ? 255 : 0};
+        }
+    }
+    qp_internal_invalidate_palette(); // The lookup table no longer holds the last interpolated palette
+    if (!target_driver->driver_vtable->palette_convert((painter_device_t)target_driver, palette_size, lookup)) {
+        qp_dprintf("qp_surface_indexed_pixdata_transfer: fail (could not convert palette to target format)\n");
+        return false;
+    }
+
+    // Set the target drawing area
+    bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
+    if (!ok) {
+        qp_dprintf("qp_surface_indexed_pixdata_transfer: fail (could not set target viewport)\n");
+        return false;
+    }
+
+    // Housekeeping of the amount of pixels to transfer
+    const uint32_t max_pixels    = qp_internal_num_pixels_in_buffer((painter_device_t)target_driver);
+    uint32_t       pixel_counter = 0;
+    uint8_t        indices[SURFACE_TRANSFER_BLOCK_PIXELS];
+    uint8_t        index_count = 0;
+
+    for (uint16_t y = t; y <= b; ++y) {
+        // Rows aren't byte-aligned, so start part-way through the first byte
+        uint32_t       pixel_num = y * surface_handle->base.panel_width + l;
+        const uint8_t *src       = &surface_handle->u8buffer[pixel_num / pixels_per_byte];
+        uint8_t        remain    = pixels_per_byte - (pixel_num % pixels_per_byte);
+        uint8_t        bits      = *src++ >> ((pixel_num % pixels_per_byte) * bpp);
+
+        for (uint16_t x = l; x <= r; ++x) {
+            if (remain == 0) {
+                bits   = *src++;
+                remain = pixels_per_byte;
+            }
+            indices[index_count++] = bits & index_mask;
+            bits >>= bpp;
+            --remain;
+
+            // Expand a block of indices at a time, sending the pixdata buffer whenever it fills up
+            if (index_count == SURFACE_TRANSFER_BLOCK_PIXELS || pixel_counter + index_count == max_pixels) {
+                target_driver->driver_vtable->append_pixels((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, lookup, pixel_counter, index_count, indices);
+                pixel_counter += index_count;
+                index_count = 0;
+
+                if (pixel_counter == max_pixels) {
+                    ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
+                    if (!ok) {
+                        qp_dprintf("qp_surface_indexed_pixdata_transfer: fail (could not stream pixdata to target)\n");
+                        return false;
+                    }
+                    pixel_counter = 0;
+                }
+            }
+        }
+    }
+
+    // If there's any leftover data, send it
+    if (index_count > 0) {
+        target_driver->driver_vtable->append_pixels((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, lookup, pixel_counter, index_count, indices);
+        pixel_counter += index_count;
+    }
+    if (pixel_counter > 0) {
+        ok = qp_pixdata((painter_device_t)target_driver, qp_internal_global_pixdata_buffer, pixel_counter);
+        if (!ok) {
+            qp_dprintf("qp_surface_indexed_pixdata_transfer: fail (could not stream pixdata to target)\n");
+            return false;
+        }
+    }
+
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Drawing routine to copy out the dirty region and send it to another device
 
@@ -116,12 +218,6 @@ bool qp_surface_draw(painter_device_t surface, painter_device_t target, uint16_t
         return true;
     }
 
-    // If we have incompatible bit depths, drop out
-    if (surface_driver->native_bits_per_pixel != target_driver->native_bits_per_pixel) {
-        qp_dprintf("qp_surface_draw: fail (incompatible bpp: surface=%d, target=%d)\n", (int)surface_driver->native_bits_per_pixel, (int)target_driver->native_bits_per_pixel);
-        return false;
-    }
-
     // Offload to the pixdata transfer function
     surface_painter_driver_vtable_t *vtable = (surface_painter_driver_vtable_t *)surface_driver->driver_vtable;
     bool                             ok     = vtable->target_pixdata_transfer(surface_driver, target_driver, x, y, entire_surface);
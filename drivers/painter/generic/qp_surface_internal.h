@@ -48,6 +48,9 @@ typedef struct surface_painter_device_t {
         rgb_t    *rgbbuffer;
     };
 
+    // The colors of each palette index, for palette-indexed surfaces
+    const hsv_t *palette;
+
     // Manually manage the viewport for streaming pixel data to the display
     surface_viewport_data_t viewport;
 
@@ -79,6 +82,32 @@ painter_device_t qp_make_rgb565_surface_advanced(surface_painter_device_t *devic
  */
 painter_device_t qp_make_mono1bpp_surface_advanced(surface_painter_device_t *device_table, size_t device_table_len, uint16_t panel_width, uint16_t panel_height, void *buffer);
 
+/**
+ * Factory method for an RGB888 surface (aka framebuffer). Accepts an external device table.
+ *
+ * @param device_table[in] the table of devices to use for instantiation
+ * @param device_table_len[in] the length of the table of devices
+ * @param panel_width[in] the width of the display panel
+ * @param panel_height[in] the height of the display panel
+ * @param buffer[in] pointer to a preallocated uint8_t buffer of size `SURFACE_REQUIRED_BUFFER_BYTE_SIZE(panel_width, panel_height, 24)`
+ * @return the device handle used with all drawing routines in Quantum Painter
+ */
+painter_device_t qp_make_rgb888_surface_advanced(surface_painter_device_t *device_table, size_t device_table_len, uint16_t panel_width, uint16_t panel_height, void *buffer);
+
+/**
+ * Factory method for a palette-indexed surface (aka framebuffer). Accepts an external device table.
+ *
+ * @param device_table[in] the table of devices to use for instantiation
+ * @param device_table_len[in] the length of the table of devices
+ * @param panel_width[in] the width of the display panel
+ * @param panel_height[in] the height of the display panel
+ * @param bits_per_pixel[in] the size of each palette index, one of 1, 2, 4 or 8
+ * @param palette[in] pointer to `(1 << bits_per_pixel)` colors, which must remain valid for the lifetime of the surface
+ * @param buffer[in] pointer to a preallocated uint8_t buffer of size `SURFACE_REQUIRED_BUFFER_BYTE_SIZE(panel_width, panel_height, bits_per_pixel)`
+ * @return the device handle used with all drawing routines in Quantum Painter
+ */
+painter_device_t qp_make_palette_surface_advanced(surface_painter_device_t *device_table, size_t device_table_len, uint16_t panel_width, uint16_t panel_height, uint8_t bits_per_pixel, const hsv_t *palette, void *buffer);
+
 // Driver storage
 extern surface_painter_device_t surface_drivers[SURFACE_NUM_DEVICES];
 
@@ -90,6 +119,7 @@ bool qp_surface_flush(painter_device_t device);
 bool qp_surface_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
 void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport);
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y);
+bool qp_surface_indexed_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface, const hsv_t *palette);
 
 #endif // QUANTUM_PAINTER_SURFACE_ENABLE
 
@@ -85,7 +85,7 @@ static bool qp_surface_append_pixels_mono1bpp(painter_device_t device, uint8_t *
 }
 
 static bool mono1bpp_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
-    return false; // Not yet supported.
+    return qp_surface_indexed_pixdata_transfer(surface_driver, target_driver, x, y, entire_surface, NULL);
 }
 
 static bool qp_surface_append_pixdata_mono1bpp(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
@@ -0,0 +1,183 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef QUANTUM_PAINTER_SURFACE_ENABLE
+
+#    include "color.h"
+#    include "qp_draw.h"
+#    include "qp_surface_internal.h"
+#    include "qp_comms_dummy.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Surface driver impl: palette-indexed
+
+static inline void setpixel_palette(surface_painter_device_t *surface, uint16_t x, uint16_t y, uint8_t palette_idx) {
+    uint16_t w = surface->base.panel_width;
+    uint16_t h = surface->base.panel_height;
+
+    // Drop out if it's off-screen
+    if (x >= w || y >= h) {
+        return;
+    }
+
+    // Figure out which location needs to be updated
+    uint8_t  bpp             = surface->base.native_bits_per_pixel;
+    uint8_t  pixels_per_byte = 8 / bpp;
+    uint32_t pixel_num       = y * w + x;
+    uint32_t byte_offset     = pixel_num / pixels_per_byte;
+    uint8_t  bit_offset      = (pixel_num % pixels_per_byte) * bpp;
+    uint8_t  mask            = ((1 << bpp) - 1) << bit_offset;
+    uint8_t  curr_val        = surface->u8buffer[byte_offset];
+    uint8_t  new_val         = (curr_val & ~mask) | ((palette_idx << bit_offset) & mask);
+
+    // Skip messing with the dirty info if the original value already matches
+    if (curr_val != new_val) {
+        // Update the dirty region
+        qp_surface_update_dirty(&surface->dirty, x, y);
+
+        // Update the pixel data in the buffer
+        surface->u8buffer[byte_offset] = new_val;
+    }
+}
+
+static inline void append_pixel_palette(surface_painter_device_t *surface, uint8_t palette_idx) {
+    setpixel_palette(surface, surface->viewport.pixdata_x, surface->viewport.pixdata_y, palette_idx);
+    qp_surface_increment_pixdata_location(&surface->viewport);
+}
+
+static inline void stream_pixdata_palette(surface_painter_device_t *surface, const uint8_t *data, uint32_t native_pixel_count) {
+    uint8_t bpp             = surface->base.native_bits_per_pixel;
+    uint8_t pixels_per_byte = 8 / bpp;
+    uint8_t mask            = (1 << bpp) - 1;
+    for (uint32_t pixel_counter = 0; pixel_counter < native_pixel_count; ++pixel_counter) {
+        uint32_t byte_offset = pixel_counter / pixels_per_byte;
+        uint8_t  bit_offset  = (pixel_counter % pixels_per_byte) * bpp;
+        append_pixel_palette(surface, (data[byte_offset] >> bit_offset) & mask);
+    }
+}
+
+// Stream pixel data to the current write position in GRAM
+static bool qp_surface_pixdata_palette(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    painter_driver_t         *driver  = (painter_driver_t *)device;
+    surface_painter_device_t *surface = (surface_painter_device_t *)driver;
+    stream_pixdata_palette(surface, (const uint8_t *)pixel_data, native_pixel_count);
+    return true;
+}
+
+// Finds the palette entry closest to the supplied color, preferring an exact match
+static uint8_t closest_palette_idx(const hsv_t *palette, uint16_t palette_size, hsv_t hsv) {
+    for (uint16_t i = 0; i < palette_size; ++i) {
+        if (palette[i].h == hsv.h && palette[i].s == hsv.s && palette[i].v == hsv.v) {
+            return i;
+        }
+    }
+
+    rgb_t    rgb           = hsv_to_rgb_nocie(hsv);
+    uint8_t  best_idx      = 0;
+    uint32_t best_distance = UINT32_MAX;
+    for (uint16_t i = 0; i < palette_size; ++i) {
+        rgb_t    entry    = hsv_to_rgb_nocie(palette[i]);
+        int16_t  dr       = (int16_t)entry.r - rgb.r;
+        int16_t  dg       = (int16_t)entry.g - rgb.g;
+        int16_t  db       = (int16_t)entry.b - rgb.b;
+        uint32_t distance = (uint32_t)(dr * dr) + (uint32_t)(dg * dg) + (uint32_t)(db * db);
+        if (distance < best_distance) {
+            best_idx      = i;
+            best_distance = distance;
+        }
+    }
+    return best_idx;
+}
+
+// Pixel colour conversion
+static bool qp_surface_palette_convert_palette(painter_device_t device, int16_t palette_size, qp_pixel_t *palette) {
+    painter_driver_t         *driver  = (painter_driver_t *)device;
+    surface_painter_device_t *surface = (surface_painter_device_t *)driver;
+    for (int16_t i = 0; i < palette_size; ++i) {
+        palette[i].palette_idx = closest_palette_idx(surface->palette, 1 << driver->native_bits_per_pixel, palette[i].hsv888);
+    }
+    return true;
+}
+
+// Append pixels to the target location, keyed by the pixel index
+static bool qp_surface_append_pixels_palette(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices) {
+    painter_driver_t *driver          = (painter_driver_t *)device;
+    uint8_t           bpp             = driver->native_bits_per_pixel;
+    uint8_t           pixels_per_byte = 8 / bpp;
+    uint8_t           mask            = (1 << bpp) - 1;
+    for (uint32_t i = 0; i < pixel_count; ++i) {
+        uint32_t pixel_num   = pixel_offset + i;
+        uint32_t byte_offset = pixel_num / pixels_per_byte;
+        uint8_t  bit_offset  = (pixel_num % pixels_per_byte) * bpp;
+        target_buffer[byte_offset] &= ~(mask << bit_offset);
+        target_buffer[byte_offset] |= (palette[palette_indices[i]].palette_idx & mask) << bit_offset;
+    }
+    return true;
+}
+
+static bool palette_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+    return qp_surface_indexed_pixdata_transfer(surface_driver, target_driver, x, y, entire_surface, surface_handle->palette);
+}
+
+static bool qp_surface_append_pixdata_palette(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    return false; // Palette images carry their own palette, so they're always converted through palette_convert.
+}
+
+const surface_painter_driver_vtable_t palette_surface_driver_vtable = {
+    .base =
+        {
+            .init            = qp_surface_init,
+            .power           = qp_surface_power,
+            .clear           = qp_surface_clear,
+            .flush           = qp_surface_flush,
+            .pixdata         = qp_surface_pixdata_palette,
+            .viewport        = qp_surface_viewport,
+            .palette_convert = qp_surface_palette_convert_palette,
+            .append_pixels   = qp_surface_append_pixels_palette,
+            .append_pixdata  = qp_surface_append_pixdata_palette,
+        },
+    .target_pixdata_transfer = palette_target_pixdata_transfer,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Factory functions for creating a handle to a palette-indexed surface
+
+painter_device_t qp_make_palette_surface_advanced(surface_painter_device_t *device_table, size_t device_table_len, uint16_t panel_width, uint16_t panel_height, uint8_t bits_per_pixel, const hsv_t *palette, void *buffer) {
+    switch (bits_per_pixel) {
+        case 1:
+        case 2:
+        case 4:
+#    if QUANTUM_PAINTER_SUPPORTS_256_PALETTE
+        case 8:
+#    endif // QUANTUM_PAINTER_SUPPORTS_256_PALETTE
+            break;
+        default:
+            qp_dprintf("qp_make_palette_surface: fail (unsupported bpp: %d)\n", (int)bits_per_pixel);
+            return NULL;
+    }
+
+    for (uint32_t i = 0; i < device_table_len; ++i) {
+        surface_painter_device_t *driver = &device_table[i];
+        if (!driver->base.driver_vtable) {
+            driver->base.driver_vtable         = (painter_driver_vtable_t *)&palette_surface_driver_vtable;
+            driver->base.native_bits_per_pixel = bits_per_pixel;
+            driver->base.comms_vtable          = &dummy_comms_vtable;
+            driver->base.panel_width           = panel_width;
+            driver->base.panel_height          = panel_height;
+            driver->base.rotation              = QP_ROTATION_0;
+            driver->base.offset_x              = 0;
+            driver->base.offset_y              = 0;
+            driver->buffer                     = buffer;
+            driver->palette                    = palette;
+            return (painter_device_t)driver;
+        }
+    }
+    return NULL;
+}
+
+painter_device_t qp_make_palette_surface(uint16_t panel_width, uint16_t panel_height, uint8_t bits_per_pixel, const hsv_t *palette, void *buffer) {
+    return qp_make_palette_surface_advanced(surface_drivers, SURFACE_NUM_DEVICES, panel_width, panel_height, bits_per_pixel, palette, buffer);
+}
+
+#endif // QUANTUM_PAINTER_SURFACE_ENABLE
@@ -69,6 +69,12 @@ static bool qp_surface_append_pixels_rgb888(painter_device_t device, uint8_t *ta
 static bool rgb888_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
     surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
 
+    // Pixels are copied as-is, so the target needs the same format
+    if (surface_driver->native_bits_per_pixel != target_driver->native_bits_per_pixel) {
+        qp_dprintf("rgb888_target_pixdata_transfer: fail (incompatible bpp: surface=%d, target=%d)\n", (int)surface_driver->native_bits_per_pixel, (int)target_driver->native_bits_per_pixel);
+        return false;
+    }
+
     uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
     uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
     uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
@@ -99,8 +105,9 @@ static bool rgb888_target_pixdata_transfer(painter_driver_t *surface_driver, pai
                     qp_dprintf("rgb888_target_pixdata_transfer: fail (could not stream pixdata to target)\n");
                     return false;
                 }
-                // Reset the counter
+                // Reset the counter, the target may have swapped to the other pixdata buffer while this one is being sent
                 pixel_counter = 0;
+                target_buffer = (rgb_t *)qp_internal_global_pixdata_buffer;
             }
         }
     }
@@ -17,6 +17,7 @@
 #include "spi_master.h"
 #include "adns9800.h"
 #include "wait.h"
+#include "pointing_device_internal.h"
 
 // registers
 // clang-format off
@@ -101,16 +102,16 @@ void adns9800_write(uint8_t reg_addr, uint8_t data) {
     spi_write(reg_addr | MSB1);
     spi_write(data);
     spi_stop();
-    wait_us(US_BETWEEN_WRITES);
+    pd_wait_us(US_BETWEEN_WRITES);
 }
 
 uint8_t adns9800_read(uint8_t reg_addr) {
     adns9800_spi_start();
     spi_write(reg_addr & 0x7f);
-    wait_us(US_DELAY_AFTER_ADDR);
+    pd_wait_us(US_DELAY_AFTER_ADDR);
     uint8_t data = spi_read();
     spi_stop();
-    wait_us(US_BETWEEN_READS);
+    pd_wait_us(US_BETWEEN_READS);
 
     return data;
 }
@@ -227,7 +228,7 @@ report_adns9800_t adns9800_get_report(void) {
     // start burst mode
     spi_write(REG_Motion_Burst & 0x7f);
 
-    wait_us(US_BEFORE_MOTION);
+    pd_wait_us(US_BEFORE_MOTION);
 
     uint8_t motion = spi_read();
 
@@ -52,7 +52,7 @@ uint8_t paw3222_read(uint8_t reg_addr) {
     spi_start(PAW3222_CS_PIN, false, 3, PAW3222_SPI_DIVISOR);
     wait_us(1); // Tncs_lead
     spi_write(reg_addr & MSB0);
-    wait_us(10); // Tprep_rd
+    pd_wait_us(10); // Tprep_rd
     uint8_t data = spi_read();
     wait_us(1); // Tncs_lag
     spi_stop();
@@ -73,12 +73,12 @@ bool pmw33xx_write(uint8_t sensor, uint8_t reg_addr, uint8_t data) {
     }
 
     // tSCLK-NCS for write operation is 35us
-    wait_us(35);
+    pd_wait_us(35);
     spi_stop();
 
     // tSWW/tSWR (=18us) minus tSCLK-NCS. Could be shortened, but it looks like
     // a safe lower bound
-    wait_us(145);
+    pd_wait_us(145);
     return true;
 }
 
@@ -90,7 +90,7 @@ uint8_t pmw33xx_read(uint8_t sensor, uint8_t reg_addr) {
     // send adress of the register, with MSBit = 0 to indicate it's a read
     spi_write(reg_addr & 0x7f);
     // tSRAD (=160us)
-    wait_us(160);
+    pd_wait_us(160);
     uint8_t data = spi_read();
 
     // tSCLK-NCS, 120ns
@@ -98,7 +98,7 @@ uint8_t pmw33xx_read(uint8_t sensor, uint8_t reg_addr) {
     spi_stop();
 
     //  tSRW/tSRR (=20us) mins tSCLK-NCS
-    wait_us(19);
+    pd_wait_us(19);
     return data;
 }
 
@@ -217,7 +217,7 @@ pmw33xx_report_t pmw33xx_read_burst(uint8_t sensor) {
     }
 
     spi_write(REG_Motion_Burst);
-    wait_us(35); // waits for tSRAD_MOTBR
+    pd_wait_us(35); // waits for tSRAD_MOTBR
 
     spi_receive((uint8_t *)&report, sizeof(report));
 
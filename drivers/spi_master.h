@@ -93,6 +93,26 @@ spi_status_t spi_read(void);
  */
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
+/**
+ * \brief Start sending multiple bytes to the selected SPI device, returning before the transfer has completed.
+ *
+ * On platforms without background transfers this is the same as `spi_transmit()`. The other SPI functions wait for
+ * the transfer to complete before doing anything else.
+ *
+ * \param data A pointer to the data to write from. It must remain valid until `spi_transmit_busy()` returns `false`.
+ * \param length The number of bytes to write. Take care not to overrun the length of `data`.
+ *
+ * \return `SPI_STATUS_ERROR` if the transfer could not be started, otherwise `SPI_STATUS_SUCCESS`.
+ */
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+/**
+ * \brief Check whether a transfer started by `spi_transmit_async()` is still in progress.
+ *
+ * \return `true` while the transfer is running, otherwise `false`.
+ */
+bool spi_transmit_busy(void);
+
 /**
  * \brief Receive multiple bytes from the selected SPI device.
  *
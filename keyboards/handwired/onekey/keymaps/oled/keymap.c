@@ -159,9 +159,6 @@ tap_dance_action_t tap_dance_actions[] = {[TD_OLED] = ACTION_TAP_DANCE_FN(dance_
 
 const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {LAYOUT_ortho_1x1(TD(TD_OLED))};
 
-// `bool oled_is_dirty(void)` does not exist at the moment
-extern OLED_BLOCK_TYPE oled_dirty;
-
 static inline uint8_t pixel_width(void) {
     if (!(rotation & OLED_ROTATION_90)) {
         return OLED_DISPLAY_WIDTH;
@@ -364,7 +361,7 @@ oled_rotation_t oled_init_user(oled_rotation_t rotation) {
 bool oled_task_user(void) {
     if (update_speed_test) {
         // Speed test mode - wait for screen update completion.
-        if (!oled_dirty) {
+        if (!oled_is_dirty()) {
             // Update statistics and send the measurement result to the console.
             update_speed_count++;
             if (update_speed_count % 256 == 0) {
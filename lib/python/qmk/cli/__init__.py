@@ -107,6 +107,7 @@ subcommands = [
     'qmk.cli.painter',
     'qmk.cli.pytest',
     'qmk.cli.resolve_alias',
+    'qmk.cli.split_stats',
     'qmk.cli.test.c',
     'qmk.cli.userspace.add',
     'qmk.cli.userspace.compile',
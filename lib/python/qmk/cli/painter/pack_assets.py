@@ -0,0 +1,58 @@
+"""This script packs QGF images and QFF fonts into an asset directory, for storing in external flash.
+"""
+import struct
+from qmk.path import normpath
+from milc import cli
+
+QPA_NAME_LENGTH = 24
+QPA_ENTRY_SIZE = QPA_NAME_LENGTH + 8
+
+
+def _block_header(type_id, length):
+    return struct.pack('<BBI', type_id, (~type_id) & 0xFF, length)[:5]
+
+
+@cli.argument('-o', '--output', required=True, type=normpath, help='Specify output file, to be written to external flash.')
+@cli.argument('inputs', nargs='+', arg_only=True, type=normpath, help='The QGF and QFF files to pack, each named after its file name without extensions.')
+@cli.subcommand('Packs QGF images and QFF fonts into an asset directory for external flash')
+def painter_pack_assets(cli):
+    """Packs QGF images and QFF fonts into a Quantum Painter asset directory.
+
+    Firmware can then load the assets by name with `qp_load_image_asset` and `qp_load_font_asset`, once the output has been written to external flash at `QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS`.
+    """
+    assets = {}
+    for input in cli.args.inputs:
+        if not input.exists():
+            cli.log.error(f'Input file {input} does not exist!')
+            return False
+
+        name = input.name.split('.')[0]
+        if len(name.encode('utf-8')) > QPA_NAME_LENGTH:
+            cli.log.error(f'Asset name "{name}" is longer than {QPA_NAME_LENGTH} bytes!')
+            return False
+        if name in assets:
+            cli.log.error(f'Asset name "{name}" is used more than once!')
+            return False
+        assets[name] = input.read_bytes()
+
+    # Entries are sorted by name, so that the firmware can binary search them
+    names = sorted(assets.keys(), key=lambda name: name.encode('utf-8'))
+
+    # Directory descriptor, then the entry table
+    out = bytearray()
+    out += _block_header(0x00, 6)
+    out += struct.pack('<I', 0x415051)[:3]  # "QPA"
+    out += struct.pack('<BH', 0x01, len(names))
+    out += _block_header(0x01, len(names) * QPA_ENTRY_SIZE)
+
+    offset = len(out) + len(names) * QPA_ENTRY_SIZE
+    for name in names:
+        out += name.encode('utf-8').ljust(QPA_NAME_LENGTH, b'\0')
+        out += struct.pack('<II', offset, len(assets[name]))
+        offset += len(assets[name])
+
+    for name in names:
+        out += assets[name]
+
+    cli.args.output.write_bytes(out)
+    cli.log.info(f'Wrote {len(names)} assets ({len(out)} bytes) to {cli.args.output}.')
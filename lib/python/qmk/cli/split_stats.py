@@ -0,0 +1,88 @@
+"""Read the split transport statistics of a keyboard over raw HID.
+"""
+import struct
+
+from milc import cli
+
+RAW_USAGE_PAGE = 0xFF60
+RAW_USAGE_ID = 0x61
+RAW_EPSIZE = 32
+
+# Matches split_transaction_stats_report_t in quantum/split_common/transactions.h
+REPORT_FORMAT = '<BHIIIIHH'
+
+
+def _parse_id(value):
+    return int(value, 0)
+
+
+def _find_device(vid, pid):
+    import hid
+
+    for device in hid.enumerate():
+        if device['usage_page'] != RAW_USAGE_PAGE or device['usage'] != RAW_USAGE_ID:
+            continue
+        if vid is not None and device['vendor_id'] != vid:
+            continue
+        if pid is not None and device['product_id'] != pid:
+            continue
+        return device
+    return None
+
+
+def _read_stats(device, command_id, transaction_id):
+    """Request the statistics of a single transaction ID.
+    """
+    request = bytes([0x00, command_id, transaction_id]) + bytes(RAW_EPSIZE - 2)
+    device.write(request)
+
+    response = bytes(device.read(RAW_EPSIZE, timeout_ms=500))
+    if len(response) < 2 + struct.calcsize(REPORT_FORMAT) or response[0] != command_id or response[1] != transaction_id:
+        return None
+
+    return struct.unpack_from(REPORT_FORMAT, response, 2)
+
+
+@cli.argument('--vid', arg_only=True, type=_parse_id, help='USB vendor ID of the keyboard.')
+@cli.argument('--pid', arg_only=True, type=_parse_id, help='USB product ID of the keyboard.')
+@cli.argument('--command-id', arg_only=True, type=_parse_id, default=0xF0, help='Raw HID command ID, see SPLIT_TRANSACTION_STATS_RAW_HID_ID. Default: 0xF0')
+@cli.subcommand('Print the split transport statistics of a keyboard built with SPLIT_TRANSACTION_STATS.', hidden=False if cli.config.user.developer else True)
+def split_stats(cli):
+    """Query every transaction ID and print a table of the statistics.
+    """
+    import hid
+
+    info = _find_device(cli.args.vid, cli.args.pid)
+    if not info:
+        cli.log.error('No raw HID device found.')
+        return False
+
+    device = hid.device()
+    device.open_path(info['path'])
+    try:
+        first = _read_stats(device, cli.args.command_id, 0)
+        if not first:
+            cli.log.error('%s does not answer split statistics requests.', info['product_string'])
+            return False
+
+        count, cycles_per_second = first[0], first[1]
+        cli.echo('%s: {fg_cyan}%d{fg_reset} cycles/s', info['product_string'], cycles_per_second)
+        cli.echo('{style_bright}%4s %10s %10s %8s %10s %7s %7s %7s{style_reset_all}', 'id', 'attempts', 'failures', 'errors', 'bytes', 'min us', 'avg us', 'max us')
+
+        for transaction_id in range(count):
+            stats = first if transaction_id == 0 else _read_stats(device, cli.args.command_id, transaction_id)
+            if not stats:
+                cli.log.warning('No answer for transaction %d.', transaction_id)
+                continue
+
+            _, _, attempts, failures, transferred, total_us, min_us, max_us = stats
+            if attempts == 0:
+                continue
+
+            error_rate = 100.0 * failures / attempts
+            line = '%4d %10d {fg_red}%10d %7.2f%%{fg_reset} %10d %7d %7d %7d' if failures else '%4d %10d %10d %7.2f%% %10d %7d %7d %7d'
+            cli.echo(line, transaction_id, attempts, failures, error_rate, transferred, min_us, total_us // attempts, max_us)
+    finally:
+        device.close()
+
+    return True
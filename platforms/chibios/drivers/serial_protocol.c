@@ -7,8 +7,13 @@
 #include "serial_protocol.h"
 #include "synchronization_util.h"
 
+#if defined(SERIAL_USART_PIPELINED)
+#    define initiate_transaction serial_protocol_pipelined_initiate
+#    define react_to_transaction serial_protocol_pipelined_react
+#else
 static inline bool initiate_transaction(uint8_t transaction_id);
 static inline bool react_to_transaction(void);
+#endif
 
 /**
  * @brief This thread runs on the slave and responds to transactions initiated
@@ -45,6 +50,16 @@ void soft_serial_initiator_init(void) {
     serial_transport_driver_master_init();
 }
 
+__attribute__((weak)) bool serial_transport_send_sg(const serial_buffer_t* buffers, const size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (buffers[i].size && unlikely(!serial_transport_send(buffers[i].data, buffers[i].size))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#if !defined(SERIAL_USART_PIPELINED)
 /**
  * @brief React to transactions started by the master.
  */
@@ -92,6 +107,7 @@ static inline bool react_to_transaction(void) {
 
     return true;
 }
+#endif
 
 /**
  * @brief Start transaction from the master half to the slave half.
@@ -100,13 +116,17 @@ static inline bool react_to_transaction(void) {
  * @return bool Indicates success of transaction.
  */
 bool soft_serial_transaction(int index) {
+#if !defined(SERIAL_USART_PIPELINED)
     /* Clear the receive queue, to start with a clean slate.
-     * Parts of failed transactions or spurious bytes could still be in it. */
+     * Parts of failed transactions or spurious bytes could still be in it.
+     * The pipelined protocol only does so after a failed attempt. */
     serial_transport_driver_clear();
+#endif
 
     return initiate_transaction((uint8_t)index);
 }
 
+#if !defined(SERIAL_USART_PIPELINED)
 /**
  * @brief Initiate transaction to slave half.
  */
@@ -156,3 +176,4 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     return true;
 }
+#endif
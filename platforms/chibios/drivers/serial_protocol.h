@@ -24,6 +24,22 @@ void serial_transport_driver_slave_init(void);
  */
 void serial_transport_driver_master_init(void);
 
+typedef struct serial_buffer_t {
+    const uint8_t* data;
+    size_t         size;
+} serial_buffer_t;
+
+/**
+ * @brief Blocking send of several buffers with timeout, one after the other
+ * and without copying them together first. The default implementation calls
+ * serial_transport_send() for each buffer; drivers which can send them as
+ * one burst may override it.
+ *
+ * @return true Send success.
+ * @return false Send failed, e.g. by timeout or bit errors.
+ */
+bool __attribute__((nonnull, hot)) serial_transport_send_sg(const serial_buffer_t* buffers, const size_t count);
+
 /**
  * @brief  Blocking receive of size * bytes.
  *
@@ -47,3 +63,27 @@ bool __attribute__((nonnull, hot)) serial_transport_receive_blocking(uint8_t* de
  * @return false Send failed, e.g. by timeout or bit errors.
  */
 bool __attribute__((nonnull, hot)) serial_transport_send(const uint8_t* source, const size_t size);
+
+#if defined(SERIAL_USART_PIPELINED)
+#    ifndef SERIAL_USART_PIPELINED_RETRIES
+#        define SERIAL_USART_PIPELINED_RETRIES 2
+#    endif
+
+/**
+ * @brief Master side of the pipelined protocol: send the request frame of a
+ * transaction and receive its response, retransmitting on errors.
+ *
+ * @return true Transaction success.
+ * @return false Transaction failed after all retransmits.
+ */
+bool serial_protocol_pipelined_initiate(uint8_t transaction_id);
+
+/**
+ * @brief Slave side of the pipelined protocol: wait for a request frame,
+ * execute it and send back the response frame.
+ *
+ * @return true Response sent.
+ * @return false Receive or send failed, e.g. by a corrupted frame.
+ */
+bool serial_protocol_pipelined_react(void);
+#endif
@@ -0,0 +1,185 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "serial.h"
+#include "serial_protocol.h"
+#include "synchronization_util.h"
+#include "crc.h"
+#include "util.h"
+
+#if defined(SERIAL_USART_PIPELINED)
+
+#    if !defined(SERIAL_USART_FULL_DUPLEX)
+#        error "SERIAL_USART_PIPELINED requires SERIAL_USART_FULL_DUPLEX"
+#    endif
+
+#    ifndef likely
+#        define likely(x) __builtin_expect(!!(x), 1)
+#    endif
+#    ifndef unlikely
+#        define unlikely(x) __builtin_expect(!!(x), 0)
+#    endif
+
+/* Requests and responses share the same frame layout:
+ *
+ *   | sequence | transaction id | payload ... | crc8 |
+ *
+ * The crc8 covers the header and the payload. The payload size is implied by
+ * the transaction id, so a whole frame is sent in a single burst without any
+ * handshake byte in between. Payloads are sent straight from the split shared
+ * memory, and received into a staging buffer that is only copied into the
+ * shared memory once its crc has been checked.
+ */
+#    define FRAME_HEADER_SIZE 2
+
+typedef struct PACKED {
+    uint8_t sequence;
+    uint8_t transaction_id;
+    uint8_t payload[UINT8_MAX + 1];
+} serial_frame_t;
+
+/* Staging buffer for received frames until their crc has been checked: requests
+ * on the slave side, responses on the master side. */
+static serial_frame_t frame;
+
+/* Master side: sequence number of the next transaction. */
+static uint8_t initiator_sequence;
+
+/* Slave side: the last transaction that was executed, to recognize retransmits. */
+static bool    target_has_last;
+static uint8_t target_last_sequence;
+static uint8_t target_last_transaction_id;
+static uint8_t target_last_crc;
+
+static inline uint8_t frame_crc(const uint8_t *header, const uint8_t *payload, uint8_t payload_size) {
+    return crc8_update(crc8_update(0xFF, header, FRAME_HEADER_SIZE), payload, payload_size);
+}
+
+/**
+ * @brief Send a frame, with the payload taken straight from its buffer.
+ */
+static inline bool frame_send(uint8_t sequence, uint8_t transaction_id, const uint8_t *payload, uint8_t payload_size) {
+    const uint8_t header[FRAME_HEADER_SIZE] = {sequence, transaction_id};
+    const uint8_t crc                       = frame_crc(header, payload, payload_size);
+    const serial_buffer_t buffers[]         = {
+        {header, sizeof(header)},
+        {payload, payload_size},
+        {&crc, sizeof(crc)},
+    };
+
+    return serial_transport_send_sg(buffers, ARRAY_SIZE(buffers));
+}
+
+/**
+ * @brief Send a single request frame and wait for the matching response.
+ */
+static bool initiator_exchange(split_transaction_desc_t *transaction, uint8_t transaction_id, uint8_t sequence) {
+    if (unlikely(!frame_send(sequence, transaction_id, split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
+        serial_dprintf("SPLIT: sending request failed\n");
+        return false;
+    }
+
+    uint8_t size = transaction->target2initiator_buffer_size;
+    uint8_t crc;
+
+    if (unlikely(!serial_transport_receive(&frame.sequence, FRAME_HEADER_SIZE) || (size && !serial_transport_receive(frame.payload, size)) || !serial_transport_receive(&crc, sizeof(crc)))) {
+        serial_dprintf("SPLIT: receiving response failed\n");
+        return false;
+    }
+
+    /* A response with another sequence number is a late answer to an earlier
+     * attempt and is treated like a corrupted one. */
+    if (unlikely(frame.sequence != sequence || frame.transaction_id != transaction_id || crc != frame_crc(&frame.sequence, frame.payload, size))) {
+        serial_dprintf("SPLIT: invalid response\n");
+        return false;
+    }
+
+    /* Only a good response may replace the master's copy of the data. */
+    memcpy(split_trans_target2initiator_buffer(transaction), frame.payload, size);
+    return true;
+}
+
+/**
+ * @brief Initiate a transaction to the slave half, retransmitting it with the
+ * same sequence number if the request or the response was lost or corrupted.
+ */
+bool serial_protocol_pipelined_initiate(uint8_t transaction_id) {
+    /* Sanity check that we are actually starting a valid transaction. */
+    if (unlikely(transaction_id >= NUM_TOTAL_TRANSACTIONS)) {
+        serial_dprintf("SPLIT: illegal transaction id\n");
+        return false;
+    }
+
+    split_shared_memory_lock_autounlock();
+
+    split_transaction_desc_t *transaction = &split_transaction_table[transaction_id];
+    uint8_t                   sequence    = initiator_sequence++;
+
+    for (uint8_t attempt = 0; attempt <= SERIAL_USART_PIPELINED_RETRIES; attempt++) {
+        if (attempt > 0) {
+            /* Drop whatever is left of the failed attempt. */
+            serial_transport_driver_clear();
+        }
+
+        if (likely(initiator_exchange(transaction, transaction_id, sequence))) {
+            return true;
+        }
+    }
+
+    serial_dprintf("SPLIT: transaction %u failed\n", transaction_id);
+    return false;
+}
+
+/**
+ * @brief React to a request frame sent by the master.
+ */
+bool serial_protocol_pipelined_react(void) {
+    /* Wait until there is a frame for us. */
+    if (unlikely(!serial_transport_receive_blocking((uint8_t *)&frame, FRAME_HEADER_SIZE))) {
+        return false;
+    }
+
+    /* Sanity check that we are actually responding to a valid transaction. */
+    uint8_t transaction_id = frame.transaction_id;
+    if (unlikely(transaction_id >= NUM_TOTAL_TRANSACTIONS)) {
+        return false;
+    }
+
+    split_transaction_desc_t *transaction = &split_transaction_table[transaction_id];
+
+    /* The rest of the request is staged in the frame buffer, so a corrupted
+     * request never reaches the shared memory. */
+    uint8_t crc;
+    if (unlikely((transaction->initiator2target_buffer_size && !serial_transport_receive(frame.payload, transaction->initiator2target_buffer_size)) || !serial_transport_receive(&crc, sizeof(crc)))) {
+        return false;
+    }
+    if (unlikely(crc != frame_crc(&frame.sequence, frame.payload, transaction->initiator2target_buffer_size))) {
+        return false;
+    }
+
+    bool retransmit = target_has_last && frame.sequence == target_last_sequence && transaction_id == target_last_transaction_id && crc == target_last_crc;
+
+    split_shared_memory_lock_autounlock();
+
+    /* Only the response of a retransmitted request got lost, answer it again
+     * without running the transaction a second time. */
+    if (likely(!retransmit)) {
+        memcpy(split_trans_initiator2target_buffer(transaction), frame.payload, transaction->initiator2target_buffer_size);
+
+        /* Allow any slave processing to occur. */
+        if (transaction->slave_callback) {
+            transaction->slave_callback(transaction->initiator2target_buffer_size, split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size, split_trans_target2initiator_buffer(transaction));
+        }
+
+        target_has_last            = true;
+        target_last_sequence       = frame.sequence;
+        target_last_transaction_id = transaction_id;
+        target_last_crc            = crc;
+    }
+
+    return frame_send(frame.sequence, transaction_id, split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size);
+}
+
+#endif // SERIAL_USART_PIPELINED
@@ -436,7 +436,18 @@ bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
     return spi_start_extended(&start_config);
 }
 
+// Waits for a transfer started by spi_transmit_async() to complete, sleeping until the driver's completion interrupt
+// wakes this thread up -- the same wait spiSend() uses internally
+static inline void spi_wait_async(void) {
+    osalSysLock();
+    if (SPI_DRIVER.state == SPI_ACTIVE) {
+        osalThreadSuspendS(&SPI_DRIVER.thread);
+    }
+    osalSysUnlock();
+}
+
 spi_status_t spi_write(uint8_t data) {
+    spi_wait_async();
     uint8_t rxData;
     spiExchange(&SPI_DRIVER, 1, &data, &rxData);
 
@@ -444,6 +455,7 @@ spi_status_t spi_write(uint8_t data) {
 }
 
 spi_status_t spi_read(void) {
+    spi_wait_async();
     uint8_t data = 0;
     spiReceive(&SPI_DRIVER, 1, &data);
 
@@ -451,16 +463,29 @@ spi_status_t spi_read(void) {
 }
 
 spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
+    spi_wait_async();
     spiSend(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spi_wait_async();
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+bool spi_transmit_busy(void) {
+    return SPI_DRIVER.state == SPI_ACTIVE;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
+    spi_wait_async();
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
 }
 
 void spi_stop(void) {
+    spi_wait_async();
     if (spiStarted) {
         spi_unselect();
         spiStop(&SPI_DRIVER);
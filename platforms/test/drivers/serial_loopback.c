@@ -0,0 +1,158 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "serial_loopback.h"
+#include "serial_protocol.h"
+
+#define SERIAL_LOOPBACK_QUEUE_SIZE 1024
+#define SERIAL_LOOPBACK_NO_FAULT SIZE_MAX
+
+typedef struct {
+    uint8_t data[SERIAL_LOOPBACK_QUEUE_SIZE];
+    size_t  head;
+    size_t  tail;
+    size_t  sent;
+    size_t  corrupt_at;
+} serial_loopback_queue_t;
+
+static serial_loopback_queue_t  initiator2target;
+static serial_loopback_queue_t  target2initiator;
+static serial_loopback_target_t target_function;
+static bool                     in_target;
+static bool                     disconnected;
+static bool                     corrupt_target_always;
+static size_t                   empty_receives;
+
+static void queue_reset(serial_loopback_queue_t *queue) {
+    memset(queue, 0, sizeof(*queue));
+    queue->corrupt_at = SERIAL_LOOPBACK_NO_FAULT;
+}
+
+static size_t queue_available(const serial_loopback_queue_t *queue) {
+    return queue->tail - queue->head;
+}
+
+void serial_loopback_init(serial_loopback_target_t target) {
+    queue_reset(&initiator2target);
+    queue_reset(&target2initiator);
+    target_function       = target;
+    in_target             = false;
+    disconnected          = false;
+    corrupt_target_always = false;
+    empty_receives        = 0;
+}
+
+void serial_loopback_corrupt_initiator(size_t offset) {
+    initiator2target.corrupt_at = initiator2target.sent + offset;
+}
+
+void serial_loopback_corrupt_target(size_t offset) {
+    target2initiator.corrupt_at = target2initiator.sent + offset;
+}
+
+void serial_loopback_corrupt_target_always(bool corrupt) {
+    corrupt_target_always = corrupt;
+}
+
+void serial_loopback_disconnect(bool disconnect) {
+    disconnected = disconnect;
+}
+
+size_t serial_loopback_initiator_bytes_sent(void) {
+    return initiator2target.sent;
+}
+
+size_t serial_loopback_target_bytes_sent(void) {
+    return target2initiator.sent;
+}
+
+size_t serial_loopback_empty_receives(void) {
+    return empty_receives;
+}
+
+/* Let the slave process everything the master has sent so far, the same way
+ * the slave thread of serial_protocol.c does. */
+static void run_target(void) {
+    in_target = true;
+    while (target_function && queue_available(&initiator2target) > 0) {
+        if (!target_function()) {
+            serial_transport_driver_clear();
+        }
+    }
+    in_target = false;
+}
+
+void serial_transport_driver_clear(void) {
+    serial_loopback_queue_t *queue = in_target ? &initiator2target : &target2initiator;
+    queue->head                    = queue->tail;
+}
+
+void serial_transport_driver_slave_init(void) {}
+
+void serial_transport_driver_master_init(void) {}
+
+bool serial_transport_send(const uint8_t *source, const size_t size) {
+    serial_loopback_queue_t *queue = in_target ? &target2initiator : &initiator2target;
+
+    if (disconnected && !in_target) {
+        queue->sent += size;
+        return true;
+    }
+
+    if (queue->tail + size > SERIAL_LOOPBACK_QUEUE_SIZE) {
+        /* Compact the queue. */
+        size_t available = queue_available(queue);
+        memmove(queue->data, &queue->data[queue->head], available);
+        queue->head = 0;
+        queue->tail = available;
+        if (queue->tail + size > SERIAL_LOOPBACK_QUEUE_SIZE) {
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        uint8_t byte = source[i];
+        if (queue->sent++ == queue->corrupt_at || (in_target && corrupt_target_always)) {
+            byte ^= 0xFF;
+        }
+        queue->data[queue->tail++] = byte;
+    }
+    return true;
+}
+
+bool serial_transport_send_sg(const serial_buffer_t *buffers, const size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (!serial_transport_send(buffers[i].data, buffers[i].size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool serial_transport_receive(uint8_t *destination, const size_t size) {
+    serial_loopback_queue_t *queue = in_target ? &initiator2target : &target2initiator;
+
+    if (size == 0) {
+        empty_receives++;
+    }
+
+    if (!in_target && queue_available(queue) < size) {
+        run_target();
+    }
+
+    if (queue_available(queue) < size) {
+        /* Consume the partial data, like a timed out read would. */
+        queue->head = queue->tail;
+        return false;
+    }
+
+    memcpy(destination, &queue->data[queue->head], size);
+    queue->head += size;
+    return true;
+}
+
+bool serial_transport_receive_blocking(uint8_t *destination, const size_t size) {
+    return serial_transport_receive(destination, size);
+}
@@ -0,0 +1,35 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* In-memory stand-in for a full-duplex split serial driver, implementing the
+ * serial_transport_* API of serial_protocol.h. Both halves run in the same
+ * thread: whenever the master waits for bytes, the target function is run
+ * until the master's request has been consumed. Receives that can't be
+ * satisfied from the queues fail immediately, like a timeout would.
+ */
+
+typedef bool (*serial_loopback_target_t)(void);
+
+void serial_loopback_init(serial_loopback_target_t target);
+
+/* Invert the byte sent by the master (or the slave) `offset` bytes from now. */
+void serial_loopback_corrupt_initiator(size_t offset);
+void serial_loopback_corrupt_target(size_t offset);
+
+/* Invert every byte the slave sends until switched off again. */
+void serial_loopback_corrupt_target_always(bool corrupt);
+
+/* Drop everything the master sends, e.g. an unplugged cable. */
+void serial_loopback_disconnect(bool disconnected);
+
+size_t serial_loopback_initiator_bytes_sent(void);
+size_t serial_loopback_target_bytes_sent(void);
+
+/* Number of serial_transport_receive() calls asking for zero bytes. */
+size_t serial_loopback_empty_receives(void);
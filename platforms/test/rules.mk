@@ -23,3 +23,15 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+serial_protocol_pipelined_DEFS := -DSPLIT_KEYBOARD -DSERIAL_USART_FULL_DUPLEX -DSERIAL_USART_PIPELINED -DMATRIX_ROWS=2 -DMATRIX_COLS=2 -DNO_PRINT
+serial_protocol_pipelined_INC := \
+	$(QUANTUM_PATH)/split_common \
+	$(PLATFORM_PATH)/chibios/drivers \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)
+serial_protocol_pipelined_SRC := \
+	$(QUANTUM_PATH)/crc.c \
+	$(PLATFORM_PATH)/synchronization_util.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/drivers/serial_loopback.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/serial_protocol_pipelined_tests.cpp \
+	$(PLATFORM_PATH)/chibios/drivers/serial_protocol_pipelined.c
@@ -0,0 +1,166 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include <utility>
+
+extern "C" {
+#include "serial.h"
+#include "serial_protocol.h"
+#include "drivers/serial_loopback.h"
+}
+
+#define TEST_ECHO 0
+#define TEST_READ 1
+#define TEST_WRITE 2
+
+#define ECHO_SIZE 40
+#define READ_SIZE 8
+#define WRITE_SIZE 4
+
+typedef union {
+    split_shared_memory_t shmem;
+    uint8_t               bytes[256];
+} storage_t;
+
+// The shared memory of the master, and the one of the slave while it isn't running
+static storage_t storage;
+static storage_t target_storage;
+
+extern "C" {
+split_shared_memory_t *const split_shmem = &storage.shmem;
+split_transaction_desc_t     split_transaction_table[NUM_TOTAL_TRANSACTIONS];
+}
+
+static int echo_calls;
+static int write_calls;
+
+static void echo_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const uint8_t *in  = (const uint8_t *)initiator2target_buffer;
+    uint8_t       *out = (uint8_t *)target2initiator_buffer;
+    for (uint8_t i = 0; i < ECHO_SIZE; i++) {
+        out[i] = in[i] + 1;
+    }
+    echo_calls++;
+}
+
+static void write_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    write_calls++;
+}
+
+// Runs the slave with its own copy of the shared memory, like on a real split keyboard
+static bool target_react(void) {
+    std::swap(storage, target_storage);
+    bool okay = serial_protocol_pipelined_react();
+    std::swap(storage, target_storage);
+    return okay;
+}
+
+class SerialProtocolPipelined : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        memset(&storage, 0, sizeof(storage));
+        memset(&target_storage, 0, sizeof(target_storage));
+        memset(split_transaction_table, 0, sizeof(split_transaction_table));
+        split_transaction_table[TEST_ECHO]  = {ECHO_SIZE, 0, ECHO_SIZE, ECHO_SIZE, echo_callback};
+        split_transaction_table[TEST_READ]  = {0, 0, READ_SIZE, 2 * ECHO_SIZE, NULL};
+        split_transaction_table[TEST_WRITE] = {WRITE_SIZE, 2 * ECHO_SIZE + READ_SIZE, 0, 0, write_callback};
+        echo_calls                          = 0;
+        write_calls                         = 0;
+        serial_loopback_init(target_react);
+    }
+
+    uint8_t *buffer(int offset) {
+        return &storage.bytes[offset];
+    }
+};
+
+TEST_F(SerialProtocolPipelined, RoundTrip) {
+    for (uint8_t i = 0; i < ECHO_SIZE; i++) {
+        buffer(0)[i] = i;
+    }
+
+    EXPECT_TRUE(serial_protocol_pipelined_initiate(TEST_ECHO));
+    EXPECT_EQ(echo_calls, 1);
+    for (uint8_t i = 0; i < ECHO_SIZE; i++) {
+        EXPECT_EQ(buffer(ECHO_SIZE)[i], i + 1);
+    }
+
+    /* A single frame per direction: header, payload and crc. */
+    EXPECT_EQ(serial_loopback_initiator_bytes_sent(), 2 + ECHO_SIZE + 1);
+    EXPECT_EQ(serial_loopback_target_bytes_sent(), 2 + ECHO_SIZE + 1);
+}
+
+TEST_F(SerialProtocolPipelined, BackToBackTransactions) {
+    EXPECT_TRUE(serial_protocol_pipelined_initiate(TEST_WRITE));
+    EXPECT_TRUE(serial_protocol_pipelined_initiate(TEST_WRITE));
+    EXPECT_TRUE(serial_protocol_pipelined_initiate(TEST_READ));
+    EXPECT_TRUE(serial_protocol_pipelined_initiate(TEST_WRITE));
+
+    /* Identical requests with different sequence numbers are all executed. */
+    EXPECT_EQ(write_calls, 3);
+}
+
+TEST_F(SerialProtocolPipelined, EmptyPayloadsAreNotReceived) {
+    EXPECT_TRUE(serial_protocol_pipelined_initiate(TEST_READ));
+    EXPECT_TRUE(serial_protocol_pipelined_initiate(TEST_WRITE));
+    EXPECT_EQ(write_calls, 1);
+    EXPECT_EQ(serial_loopback_empty_receives(), 0);
+}
+
+TEST_F(SerialProtocolPipelined, CorruptedRequestIsRetransmitted) {
+    buffer(0)[5] = 42;
+    serial_loopback_corrupt_initiator(2 + 5);
+
+    EXPECT_TRUE(serial_protocol_pipelined_initiate(TEST_ECHO));
+    EXPECT_EQ(echo_calls, 1);
+    EXPECT_EQ(buffer(ECHO_SIZE)[5], 43);
+    EXPECT_EQ(serial_loopback_initiator_bytes_sent(), 2 * (2 + ECHO_SIZE + 1));
+}
+
+TEST_F(SerialProtocolPipelined, CorruptedResponseIsNotExecutedTwice) {
+    buffer(0)[7] = 7;
+    serial_loopback_corrupt_target(2 + 7);
+
+    EXPECT_TRUE(serial_protocol_pipelined_initiate(TEST_ECHO));
+    EXPECT_EQ(echo_calls, 1);
+    EXPECT_EQ(buffer(ECHO_SIZE)[7], 8);
+    EXPECT_EQ(serial_loopback_target_bytes_sent(), 2 * (2 + ECHO_SIZE + 1));
+}
+
+TEST_F(SerialProtocolPipelined, CorruptedResponseKeepsPreviousData) {
+    target_storage.bytes[2 * ECHO_SIZE] = 1;
+    EXPECT_TRUE(serial_protocol_pipelined_initiate(TEST_READ));
+    EXPECT_EQ(buffer(2 * ECHO_SIZE)[0], 1);
+
+    target_storage.bytes[2 * ECHO_SIZE] = 2;
+    serial_loopback_corrupt_target_always(true);
+    EXPECT_FALSE(serial_protocol_pipelined_initiate(TEST_READ));
+    EXPECT_EQ(buffer(2 * ECHO_SIZE)[0], 1);
+    for (uint8_t i = 1; i < READ_SIZE; i++) {
+        EXPECT_EQ(buffer(2 * ECHO_SIZE)[i], 0);
+    }
+}
+
+TEST_F(SerialProtocolPipelined, CorruptedHeaderIsRetransmitted) {
+    serial_loopback_corrupt_initiator(1);
+
+    EXPECT_TRUE(serial_protocol_pipelined_initiate(TEST_WRITE));
+    EXPECT_EQ(write_calls, 1);
+}
+
+TEST_F(SerialProtocolPipelined, FailsAfterRetransmits) {
+    serial_loopback_disconnect(true);
+    EXPECT_FALSE(serial_protocol_pipelined_initiate(TEST_WRITE));
+    EXPECT_EQ(serial_loopback_initiator_bytes_sent(), (1 + SERIAL_USART_PIPELINED_RETRIES) * (2 + WRITE_SIZE + 1));
+    EXPECT_EQ(write_calls, 0);
+
+    serial_loopback_disconnect(false);
+    EXPECT_TRUE(serial_protocol_pipelined_initiate(TEST_WRITE));
+    EXPECT_EQ(write_calls, 1);
+}
+
+TEST_F(SerialProtocolPipelined, IllegalTransaction) {
+    EXPECT_FALSE(serial_protocol_pipelined_initiate(NUM_TOTAL_TRANSACTIONS));
+    EXPECT_EQ(serial_loopback_initiator_bytes_sent(), 0);
+}
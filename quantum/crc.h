@@ -43,3 +43,15 @@ __attribute__((weak)) void crc_init(void);
  * \return             The calculated crc value.
  */
 __attribute__((weak)) uint8_t crc8(const void *data, size_t data_len);
+
+/**
+ * Continue a CRC8 calculation over another buffer, so data that is split over
+ * several buffers can be checksummed without copying it together first.
+ * crc8(data, len) equals crc8_update(0xFF, data, len).
+ *
+ * \param[in] crc      The CRC value calculated so far, or 0xFF to start.
+ * \param[in] data     Pointer to a buffer of \a data_len bytes.
+ * \param[in] data_len Number of bytes in the \a data buffer.
+ * \return             The updated crc value.
+ */
+uint8_t crc8_update(uint8_t crc, const void *data, size_t data_len);
@@ -39,6 +39,10 @@
 #    include "connection.h"
 #endif // CONNECTION_ENABLE
 
+#ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+#    include "pointing_device_transform.h"
+#endif // POINTING_DEVICE_TRANSFORM_ENABLE
+
 #ifdef VIA_ENABLE
 bool via_eeprom_is_valid(void);
 void via_eeprom_set_valid(bool valid);
@@ -140,6 +144,10 @@ void eeconfig_init_quantum(void) {
     eeconfig_update_connection_default();
 #endif // CONNECTION_ENABLE
 
+#ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+    eeconfig_update_pointing_device_default();
+#endif // POINTING_DEVICE_TRANSFORM_ENABLE
+
 #if (EECONFIG_KB_DATA_SIZE) > 0
     eeconfig_init_kb_datablock();
 #endif // (EECONFIG_KB_DATA_SIZE) > 0
@@ -321,6 +329,15 @@ void eeconfig_update_connection(const connection_config_t *config) {
 }
 #endif // CONNECTION_ENABLE
 
+#ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+void eeconfig_read_pointing_device(pointing_device_config_t *config) {
+    nvm_eeconfig_read_pointing_device(config);
+}
+void eeconfig_update_pointing_device(const pointing_device_config_t *config) {
+    nvm_eeconfig_update_pointing_device(config);
+}
+#endif // POINTING_DEVICE_TRANSFORM_ENABLE
+
 bool eeconfig_read_handedness(void) {
     return nvm_eeconfig_read_handedness();
 }
@@ -137,6 +137,12 @@ void                              eeconfig_read_connection(connection_config_t *
 void                              eeconfig_update_connection(const connection_config_t *config);
 #endif
 
+#ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+typedef union pointing_device_config_t pointing_device_config_t;
+void                                   eeconfig_read_pointing_device(pointing_device_config_t *config);
+void                                   eeconfig_update_pointing_device(const pointing_device_config_t *config);
+#endif
+
 bool eeconfig_read_handedness(void);
 void eeconfig_update_handedness(bool val);
 
@@ -4,7 +4,7 @@
 #include <string.h>
 #include "action.h"
 #include "encoder.h"
-#include "wait.h"
+#include "timer.h"
 
 #ifndef ENCODER_MAP_KEY_DELAY
 #    define ENCODER_MAP_KEY_DELAY TAP_CODE_DELAY
@@ -17,40 +17,138 @@ __attribute__((weak)) bool should_process_encoder(void) {
 static encoder_events_t encoder_events;
 static bool             signal_queue_drain = false;
 
+#ifdef ENCODER_VELOCITY_ENABLE
+#    define ENCODER_EVENT_TIME() timer_read32()
+
+// Last detent handled for each encoder
+static struct {
+    uint32_t time;
+    bool     clockwise;
+    bool     valid;
+} encoder_last_detent[NUM_ENCODERS];
+#else
+#    define ENCODER_EVENT_TIME() 0
+#endif // ENCODER_VELOCITY_ENABLE
+
+// Steps of the current event still to be handed out
+static struct {
+    uint8_t index;
+    bool    clockwise;
+    uint8_t steps;
+#if defined(ENCODER_MAP_ENABLE) && ENCODER_MAP_KEY_DELAY > 0
+    bool     pressed;
+    uint16_t timer;
+#endif
+} encoder_pending;
+
 void encoder_init(void) {
     memset(&encoder_events, 0, sizeof(encoder_events));
+    memset(&encoder_pending, 0, sizeof(encoder_pending));
+#ifdef ENCODER_VELOCITY_ENABLE
+    memset(encoder_last_detent, 0, sizeof(encoder_last_detent));
+#endif
     encoder_driver_init();
 }
 
 static void encoder_queue_drain(void) {
-    encoder_events.tail     = encoder_events.head;
+    encoder_events.tail     = __atomic_load_n(&encoder_events.head, __ATOMIC_ACQUIRE);
     encoder_events.dequeued = encoder_events.enqueued;
 }
 
-static bool encoder_handle_queue(void) {
-    bool    changed = false;
-    uint8_t index;
-    bool    clockwise;
-    while (encoder_dequeue_event(&index, &clockwise)) {
-#ifdef ENCODER_MAP_ENABLE
+#ifdef ENCODER_VELOCITY_ENABLE
+__attribute__((weak)) uint8_t encoder_velocity_steps(uint8_t index, uint8_t detents, uint16_t interval) {
+    if (interval >= ENCODER_VELOCITY_INTERVAL_MS) {
+        return detents;
+    }
+    uint16_t multiplier = ENCODER_VELOCITY_INTERVAL_MS / MAX(interval, 1);
+    multiplier          = MIN(multiplier, ENCODER_VELOCITY_MAX_MULTIPLIER);
+    return MIN(detents * multiplier, UINT8_MAX);
+}
 
-        // The delays below cater for Windows and its wonderful requirements.
-        action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, true) : MAKE_ENCODER_CCW_EVENT(index, true));
-#    if ENCODER_MAP_KEY_DELAY > 0
-        wait_ms(ENCODER_MAP_KEY_DELAY);
-#    endif // ENCODER_MAP_KEY_DELAY > 0
+// Takes the next event off the queue along with any events queued right
+// behind it for the same encoder and direction, and turns them into steps.
+static bool encoder_dequeue_steps(void) {
+    uint8_t  index;
+    bool     clockwise;
+    uint32_t time = encoder_events.times[encoder_events.tail];
+    if (!encoder_dequeue_event(&index, &clockwise)) {
+        return false;
+    }
 
-        action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, false) : MAKE_ENCODER_CCW_EVENT(index, false));
-#    if ENCODER_MAP_KEY_DELAY > 0
-        wait_ms(ENCODER_MAP_KEY_DELAY);
-#    endif // ENCODER_MAP_KEY_DELAY > 0
+    uint8_t detents = 1;
+    while (!encoder_queue_empty()) {
+        encoder_event_t next = encoder_events.queue[encoder_events.tail];
+        if (next.index != index || next.clockwise != clockwise) {
+            break;
+        }
+        time = encoder_events.times[encoder_events.tail];
+        encoder_dequeue_event(&index, &clockwise);
+        detents++;
+    }
 
-#else // ENCODER_MAP_ENABLE
+    // Average time between detents, including the one before this batch
+    uint16_t interval = UINT16_MAX;
+    if (encoder_last_detent[index].valid && encoder_last_detent[index].clockwise == clockwise) {
+        interval = MIN(TIMER_DIFF_32(time, encoder_last_detent[index].time) / detents, UINT16_MAX);
+    }
+    encoder_last_detent[index].time      = time;
+    encoder_last_detent[index].clockwise = clockwise;
+    encoder_last_detent[index].valid     = true;
 
-        encoder_update_kb(index, clockwise);
+    encoder_pending.index     = index;
+    encoder_pending.clockwise = clockwise;
+    encoder_pending.steps     = encoder_velocity_steps(index, detents, interval);
+    return true;
+}
+#else  // ENCODER_VELOCITY_ENABLE
+static bool encoder_dequeue_steps(void) {
+    if (!encoder_dequeue_event(&encoder_pending.index, &encoder_pending.clockwise)) {
+        return false;
+    }
+    encoder_pending.steps = 1;
+    return true;
+}
+#endif // ENCODER_VELOCITY_ENABLE
 
+#ifdef ENCODER_MAP_ENABLE
+// Taps the encoder keycode for the pending step. With a key delay, the press
+// and the release happen on later calls once the delay elapsed, rather than
+// blocking until then. Returns false while waiting.
+static bool encoder_map_step(void) {
+    const uint8_t index     = encoder_pending.index;
+    const bool    clockwise = encoder_pending.clockwise;
+#    if ENCODER_MAP_KEY_DELAY > 0
+    // The delays cater for Windows and its wonderful requirements.
+    if (timer_elapsed(encoder_pending.timer) < ENCODER_MAP_KEY_DELAY) {
+        return false;
+    }
+    encoder_pending.timer = timer_read();
+    if (!encoder_pending.pressed) {
+        action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, true) : MAKE_ENCODER_CCW_EVENT(index, true));
+        encoder_pending.pressed = true;
+        return true;
+    }
+    encoder_pending.pressed = false;
+#    else
+    action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, true) : MAKE_ENCODER_CCW_EVENT(index, true));
+#    endif // ENCODER_MAP_KEY_DELAY > 0
+    action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, false) : MAKE_ENCODER_CCW_EVENT(index, false));
+    encoder_pending.steps--;
+    return true;
+}
 #endif // ENCODER_MAP_ENABLE
 
+static bool encoder_handle_queue(void) {
+    bool changed = false;
+    while (encoder_pending.steps > 0 || encoder_dequeue_steps()) {
+#ifdef ENCODER_MAP_ENABLE
+        if (!encoder_map_step()) {
+            break;
+        }
+#else  // ENCODER_MAP_ENABLE
+        encoder_update_kb(encoder_pending.index, encoder_pending.clockwise);
+        encoder_pending.steps--;
+#endif // ENCODER_MAP_ENABLE
         changed = true;
     }
     return changed;
@@ -82,8 +180,12 @@ bool encoder_task(void) {
     return changed;
 }
 
+// The queue is safe to fill from an interrupt while the main loop empties it,
+// as long as there's a single producer: only the producer moves the head, and
+// only the consumer moves the tail.
+
 bool encoder_queue_full_advanced(encoder_events_t *events) {
-    return events->tail == (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    return __atomic_load_n(&events->tail, __ATOMIC_ACQUIRE) == (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS;
 }
 
 bool encoder_queue_full(void) {
@@ -91,14 +193,15 @@ bool encoder_queue_full(void) {
 }
 
 bool encoder_queue_empty_advanced(encoder_events_t *events) {
-    return events->head == events->tail;
+    return __atomic_load_n(&events->head, __ATOMIC_ACQUIRE) == events->tail;
 }
 
 bool encoder_queue_empty(void) {
     return encoder_queue_empty_advanced(&encoder_events);
 }
 
-bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool clockwise) {
+// Appends an event recorded at `time`, which is only kept for velocity detection
+static bool encoder_queue_event_at(encoder_events_t *events, uint8_t index, bool clockwise, uint32_t time) {
     // Drop out if we're full
     if (encoder_queue_full_advanced(events)) {
         return false;
@@ -107,14 +210,23 @@ bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool
     // Append the event
     encoder_event_t new_event   = {.index = index, .clockwise = clockwise ? 1 : 0};
     events->queue[events->head] = new_event;
+#ifdef ENCODER_VELOCITY_ENABLE
+    events->times[events->head] = time;
+#else
+    (void)time;
+#endif
 
-    // Increment the head index
-    events->head = (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    // Publish the event by incrementing the head index
     events->enqueued++;
+    __atomic_store_n(&events->head, (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS, __ATOMIC_RELEASE);
 
     return true;
 }
 
+bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool clockwise) {
+    return encoder_queue_event_at(events, index, clockwise, ENCODER_EVENT_TIME());
+}
+
 bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bool *clockwise) {
     if (encoder_queue_empty_advanced(events)) {
         return false;
@@ -125,9 +237,9 @@ bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bo
     *index                = event.index;
     *clockwise            = event.clockwise;
 
-    // Increment the tail index
-    events->tail = (events->tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    // Release the slot by incrementing the tail index
     events->dequeued++;
+    __atomic_store_n(&events->tail, (events->tail + 1) % MAX_QUEUED_ENCODER_EVENTS, __ATOMIC_RELEASE);
 
     return true;
 }
@@ -136,6 +248,24 @@ bool encoder_queue_event(uint8_t index, bool clockwise) {
     return encoder_queue_event_advanced(&encoder_events, index, clockwise);
 }
 
+bool encoder_queue_remote_events(encoder_events_t *events) {
+    while (!encoder_queue_empty_advanced(events)) {
+#ifdef ENCODER_VELOCITY_ENABLE
+        // Keep the time the other half recorded, not the time it arrived here
+        uint32_t time = events->times[events->tail];
+#else
+        uint32_t time = 0;
+#endif
+        uint8_t index;
+        bool    clockwise;
+        encoder_dequeue_event_advanced(events, &index, &clockwise);
+        if (!encoder_queue_event_at(&encoder_events, index, clockwise, time)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool encoder_dequeue_event(uint8_t *index, bool *clockwise) {
     return encoder_dequeue_event_advanced(&encoder_events, index, clockwise);
 }
@@ -86,6 +86,15 @@ bool encoder_update_user(uint8_t index, bool clockwise);
 #        define MAX_QUEUED_ENCODER_EVENTS MAX(4, ((NUM_ENCODERS_MAX_PER_SIDE) + 1))
 #    endif // MAX_QUEUED_ENCODER_EVENTS
 
+#    ifdef ENCODER_VELOCITY_ENABLE
+#        ifndef ENCODER_VELOCITY_INTERVAL_MS
+#            define ENCODER_VELOCITY_INTERVAL_MS 40
+#        endif // ENCODER_VELOCITY_INTERVAL_MS
+#        ifndef ENCODER_VELOCITY_MAX_MULTIPLIER
+#            define ENCODER_VELOCITY_MAX_MULTIPLIER 4
+#        endif // ENCODER_VELOCITY_MAX_MULTIPLIER
+#    endif // ENCODER_VELOCITY_ENABLE
+
 typedef struct encoder_event_t {
     uint8_t index : 7;
     uint8_t clockwise : 1;
@@ -97,6 +106,10 @@ typedef struct encoder_events_t {
     uint8_t         head;
     uint8_t         tail;
     encoder_event_t queue[MAX_QUEUED_ENCODER_EVENTS];
+#    ifdef ENCODER_VELOCITY_ENABLE
+    // When each event was recorded, indexed like the queue
+    uint32_t times[MAX_QUEUED_ENCODER_EVENTS];
+#    endif // ENCODER_VELOCITY_ENABLE
 } encoder_events_t;
 
 // Get the current queued events
@@ -105,6 +118,13 @@ void encoder_retrieve_events(encoder_events_t *events);
 // Encoder event queue management
 bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool clockwise);
 bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bool *clockwise);
+bool encoder_queue_full_advanced(encoder_events_t *events);
+bool encoder_queue_empty_advanced(encoder_events_t *events);
+bool encoder_queue_full(void);
+bool encoder_queue_empty(void);
+
+// Move events queued on the other half onto the local queue, keeping their times
+bool encoder_queue_remote_events(encoder_events_t *events);
 
 // Reset the queue to be empty
 void encoder_signal_queue_drain(void);
@@ -115,6 +135,14 @@ void encoder_signal_queue_drain(void);
 extern const uint16_t encoder_map[][NUM_ENCODERS][NUM_DIRECTIONS];
 #    endif // ENCODER_MAP_ENABLE
 
+#    ifdef ENCODER_VELOCITY_ENABLE
+// Number of steps to send for `detents` detents turned in a row, which were
+// `interval` ms apart on average (UINT16_MAX after a pause or a change of
+// direction). By default, detents faster than ENCODER_VELOCITY_INTERVAL_MS
+// are multiplied by up to ENCODER_VELOCITY_MAX_MULTIPLIER.
+uint8_t encoder_velocity_steps(uint8_t index, uint8_t detents, uint16_t interval);
+#    endif // ENCODER_VELOCITY_ENABLE
+
 // "Custom encoder lite" support
 void encoder_driver_init(void);
 void encoder_driver_task(void);
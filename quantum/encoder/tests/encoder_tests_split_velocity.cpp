@@ -0,0 +1,96 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <vector>
+
+extern "C" {
+#include "encoder.h"
+#include "encoder/tests/mock_split.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+}
+
+struct update {
+    int8_t index;
+    bool   clockwise;
+};
+
+std::vector<update> updates;
+
+bool isMaster;
+bool isLeftHand;
+
+extern "C" {
+bool is_keyboard_master(void) {
+    return isMaster;
+}
+
+bool encoder_update_kb(uint8_t index, bool clockwise) {
+    updates.push_back({index, clockwise});
+    return true;
+}
+};
+
+/* The master runs on the left, so encoder 2 is the first one on the slave */
+class EncoderSplitVelocityTest : public ::testing::Test {
+   protected:
+    encoder_events_t slave_events;
+
+    void SetUp() override {
+        isMaster   = true;
+        isLeftHand = true;
+        set_time(1000);
+        updates.clear();
+        memset(&slave_events, 0, sizeof(slave_events));
+        encoder_init();
+    }
+
+    /* A detent read by the slave at the given time */
+    void slave_detent(uint32_t t) {
+        set_time(t);
+        encoder_queue_event_advanced(&slave_events, 2, true);
+    }
+
+    /* The master picking up the slave's events at the given time */
+    size_t sync(uint32_t t) {
+        set_time(t);
+        updates.clear();
+        EXPECT_TRUE(encoder_queue_remote_events(&slave_events));
+        encoder_task();
+        return updates.size();
+    }
+};
+
+TEST_F(EncoderSplitVelocityTest, LateSyncDoesNotMultiply) {
+    slave_detent(1000);
+    EXPECT_EQ(sync(1000), 1);
+
+    // The second detent only reaches the master right before the third
+    slave_detent(1100);
+    EXPECT_EQ(sync(1190), 1);
+    slave_detent(1200);
+    EXPECT_EQ(sync(1200), 1);
+}
+
+TEST_F(EncoderSplitVelocityTest, FastSlaveDetentsAreMultiplied) {
+    slave_detent(1000);
+    EXPECT_EQ(sync(1000), 1);
+
+    // 10 ms apart on the slave, however late the master sees it
+    slave_detent(1010);
+    EXPECT_EQ(sync(1050), ENCODER_VELOCITY_MAX_MULTIPLIER);
+    for (auto& u : updates) {
+        EXPECT_EQ(u.index, 2);
+        EXPECT_EQ(u.clockwise, true);
+    }
+}
+
+TEST_F(EncoderSplitVelocityTest, SlaveQueueIsEmptiedOnSync) {
+    slave_detent(1000);
+    slave_detent(1100);
+    sync(1200);
+    EXPECT_EQ(slave_events.head, slave_events.tail);
+}
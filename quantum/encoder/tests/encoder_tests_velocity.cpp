@@ -0,0 +1,146 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <vector>
+
+extern "C" {
+#include "encoder.h"
+#include "encoder/tests/mock.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+struct update {
+    int8_t index;
+    bool   clockwise;
+};
+
+std::vector<update> updates;
+
+bool encoder_update_kb(uint8_t index, bool clockwise) {
+    updates.push_back({index, clockwise});
+    return true;
+}
+
+/* One full detent on the given encoder, read by the driver */
+void detent(uint8_t index, bool clockwise) {
+    pin_t a = index * 2, b = index * 2 + 1;
+    if (clockwise) {
+        setPin(a, false);
+        encoder_driver_task();
+        setPin(b, false);
+        encoder_driver_task();
+        setPin(a, true);
+        encoder_driver_task();
+        setPin(b, true);
+        encoder_driver_task();
+    } else {
+        setPin(b, false);
+        encoder_driver_task();
+        setPin(a, false);
+        encoder_driver_task();
+        setPin(b, true);
+        encoder_driver_task();
+        setPin(a, true);
+        encoder_driver_task();
+    }
+}
+
+class EncoderVelocityTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        set_time(1000);
+        updates.clear();
+        encoder_init();
+    }
+};
+
+TEST_F(EncoderVelocityTest, SlowDetentsAreSingleSteps) {
+    for (int i = 0; i < 3; i++) {
+        detent(0, true);
+        encoder_task();
+        advance_time(100);
+    }
+
+    ASSERT_EQ(updates.size(), 3);
+    for (auto& u : updates) {
+        EXPECT_EQ(u.index, 0);
+        EXPECT_EQ(u.clockwise, true);
+    }
+}
+
+TEST_F(EncoderVelocityTest, FastDetentsAreMultiplied) {
+    detent(0, true);
+    encoder_task();
+    updates.clear();
+
+    // 10 ms apart is four times as fast as the velocity interval
+    advance_time(10);
+    detent(0, true);
+    encoder_task();
+    EXPECT_EQ(updates.size(), ENCODER_VELOCITY_MAX_MULTIPLIER);
+}
+
+TEST_F(EncoderVelocityTest, QueuedDetentsAreCoalesced) {
+    detent(0, true);
+    encoder_task();
+    updates.clear();
+
+    // Three detents queued while the main loop was busy, 20 ms apart on average
+    advance_time(20);
+    detent(0, true);
+    advance_time(20);
+    detent(0, true);
+    advance_time(20);
+    detent(0, true);
+    encoder_task();
+
+    EXPECT_EQ(updates.size(), 3 * (ENCODER_VELOCITY_INTERVAL_MS / 20));
+}
+
+TEST_F(EncoderVelocityTest, DirectionChangeIsNotAccelerated) {
+    detent(0, true);
+    encoder_task();
+    advance_time(5);
+    detent(0, false);
+    encoder_task();
+
+    ASSERT_EQ(updates.size(), 2);
+    EXPECT_EQ(updates[0].clockwise, true);
+    EXPECT_EQ(updates[1].clockwise, false);
+}
+
+TEST_F(EncoderVelocityTest, EncodersAreNotCoalescedTogether) {
+    detent(0, true);
+    advance_time(100);
+    detent(1, true);
+    advance_time(100);
+    detent(0, true);
+    encoder_task();
+
+    ASSERT_EQ(updates.size(), 3);
+    EXPECT_EQ(updates[0].index, 0);
+    EXPECT_EQ(updates[1].index, 1);
+    EXPECT_EQ(updates[2].index, 0);
+}
+
+TEST_F(EncoderVelocityTest, QueueFromInterruptKeepsOrder) {
+    // Fill the queue the way a pin change interrupt would, with the main loop behind
+    for (int i = 0; i < MAX_QUEUED_ENCODER_EVENTS - 1; i++) {
+        EXPECT_TRUE(encoder_queue_event(i % 2, true));
+        advance_time(100);
+    }
+    EXPECT_TRUE(encoder_queue_full());
+    EXPECT_FALSE(encoder_queue_event(0, true));
+
+    encoder_task();
+    EXPECT_TRUE(encoder_queue_empty());
+    ASSERT_EQ(updates.size(), MAX_QUEUED_ENCODER_EVENTS - 1);
+    for (int i = 0; i < MAX_QUEUED_ENCODER_EVENTS - 1; i++) {
+        EXPECT_EQ(updates[i].index, i % 2);
+    }
+}
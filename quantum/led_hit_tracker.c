@@ -0,0 +1,40 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "led_hit_tracker.h"
+#include <string.h>
+
+void led_hit_tracker_init(last_hit_t *tracker) {
+    tracker->count = 0;
+    for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
+        tracker->tick[i] = UINT16_MAX;
+    }
+}
+
+void led_hit_tracker_add(last_hit_t *tracker, uint8_t index, uint8_t x, uint8_t y) {
+    // forget the oldest hit to make room
+    if (tracker->count >= LED_HITS_TO_REMEMBER) {
+        memmove(&tracker->x[0], &tracker->x[1], LED_HITS_TO_REMEMBER - 1);
+        memmove(&tracker->y[0], &tracker->y[1], LED_HITS_TO_REMEMBER - 1);
+        memmove(&tracker->index[0], &tracker->index[1], LED_HITS_TO_REMEMBER - 1);
+        memmove(&tracker->tick[0], &tracker->tick[1], (LED_HITS_TO_REMEMBER - 1) * sizeof(tracker->tick[0]));
+        tracker->count = LED_HITS_TO_REMEMBER - 1;
+    }
+
+    uint8_t slot         = tracker->count++;
+    tracker->x[slot]     = x;
+    tracker->y[slot]     = y;
+    tracker->index[slot] = index;
+    tracker->tick[slot]  = 0;
+}
+
+void led_hit_tracker_tick(last_hit_t *tracker, uint32_t elapsed) {
+    uint8_t count = tracker->count;
+    for (uint8_t i = 0; i < count; ++i) {
+        if (UINT16_MAX - elapsed < tracker->tick[i]) {
+            tracker->count--;
+            continue;
+        }
+        tracker->tick[i] += elapsed;
+    }
+}
@@ -0,0 +1,26 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+#include "util.h"
+
+// Last led hit
+#ifndef LED_HITS_TO_REMEMBER
+#    define LED_HITS_TO_REMEMBER 8
+#endif // LED_HITS_TO_REMEMBER
+
+typedef struct PACKED {
+    uint8_t  count;
+    uint8_t  x[LED_HITS_TO_REMEMBER];
+    uint8_t  y[LED_HITS_TO_REMEMBER];
+    uint8_t  index[LED_HITS_TO_REMEMBER];
+    uint16_t tick[LED_HITS_TO_REMEMBER];
+} last_hit_t;
+
+/* Shared by LED Matrix and RGB Matrix to track recent key hits for reactive effects. */
+void led_hit_tracker_init(last_hit_t *tracker);
+void led_hit_tracker_add(last_hit_t *tracker, uint8_t index, uint8_t x, uint8_t y);
+void led_hit_tracker_tick(last_hit_t *tracker, uint32_t elapsed);
@@ -5,6 +5,7 @@ LED_MATRIX_EFFECT(ALPHAS_MODS)
 // alphas = val1, mods = val2
 bool ALPHAS_MODS(effect_params_t* params) {
     LED_MATRIX_USE_LIMITS(led_min, led_max);
+    params->idle = true; // only depends on the config
 
     uint8_t val1 = led_matrix_eeconfig.val;
     uint8_t val2 = val1 + led_matrix_eeconfig.speed;
@@ -3,6 +3,7 @@ LED_MATRIX_EFFECT(SOLID)
 
 bool SOLID(effect_params_t* params) {
     LED_MATRIX_USE_LIMITS(led_min, led_max);
+    params->idle = true; // only depends on the config
 
     uint8_t val = led_matrix_eeconfig.val;
     for (uint8_t i = led_min; i < led_max; i++) {
@@ -21,6 +21,11 @@
 #include "progmem.h"
 #include "eeconfig.h"
 #include "keyboard.h"
+#ifdef LED_MATRIX_SKIP_STATIC_FRAMES
+#    include "host.h"
+#    include "action_layer.h"
+#    include "action_util.h"
+#endif
 #include "sync_timer.h"
 #include "debug.h"
 #include <string.h>
@@ -81,9 +86,26 @@ static bool            suspend_state      = false;
 static uint8_t         led_last_enable    = UINT8_MAX;
 static uint8_t         led_last_effect    = UINT8_MAX;
 static uint8_t         led_current_effect = 0;
-static effect_params_t led_effect_params  = {0, LED_FLAG_ALL, false};
+static effect_params_t led_effect_params  = {0, LED_FLAG_ALL, false, false};
 static led_task_states led_task_state     = SYNCING;
 
+#ifdef LED_MATRIX_SKIP_STATIC_FRAMES
+// everything the last frame could have depended on, while it was idle
+typedef struct PACKED {
+    uint32_t      config;
+    uint32_t      last_input;
+    layer_state_t layers;
+    layer_state_t default_layers;
+    uint8_t       host_leds;
+    uint8_t       mods;
+    bool          suspended;
+} led_frame_state_t;
+
+static led_frame_state_t led_frame_state;
+static bool              led_frame_idle       = false;
+static bool              led_redraw_requested = false;
+#endif // LED_MATRIX_SKIP_STATIC_FRAMES
+
 // double buffers
 static uint32_t led_timer_buffer;
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
@@ -199,21 +221,8 @@ void led_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
         led_count = led_matrix_map_row_column_to_led(row, col, led);
     }
 
-    if (last_hit_buffer.count + led_count > LED_HITS_TO_REMEMBER) {
-        memcpy(&last_hit_buffer.x[0], &last_hit_buffer.x[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
-        memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
-        last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
-    }
-
     for (uint8_t i = 0; i < led_count; i++) {
-        uint8_t index                = last_hit_buffer.count;
-        last_hit_buffer.x[index]     = g_led_config.point[led[i]].x;
-        last_hit_buffer.y[index]     = g_led_config.point[led[i]].y;
-        last_hit_buffer.index[index] = led[i];
-        last_hit_buffer.tick[index]  = 0;
-        last_hit_buffer.count++;
+        led_hit_tracker_add(&last_hit_buffer, led[i], g_led_config.point[led[i]].x, g_led_config.point[led[i]].y);
     }
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
@@ -241,19 +250,43 @@ static void led_task_timers(void) {
 
     // Update double buffer last hit timers
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
-    uint8_t count = last_hit_buffer.count;
-    for (uint8_t i = 0; i < count; ++i) {
-        if (UINT16_MAX - deltaTime < last_hit_buffer.tick[i]) {
-            last_hit_buffer.count--;
-            continue;
-        }
-        last_hit_buffer.tick[i] += deltaTime;
-    }
+    led_hit_tracker_tick(&last_hit_buffer, deltaTime);
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 }
 
+static bool led_task_suspended(void) {
+    return suspend_state ||
+#if LED_MATRIX_TIMEOUT > 0
+           (last_input_activity_elapsed() > (uint32_t)LED_MATRIX_TIMEOUT) ||
+#endif // LED_MATRIX_TIMEOUT > 0
+           false;
+}
+
+#ifdef LED_MATRIX_SKIP_STATIC_FRAMES
+static void led_frame_state_capture(led_frame_state_t *state, bool suspended) {
+    state->config         = led_matrix_eeconfig.raw;
+    state->last_input     = last_input_activity_time();
+    state->layers         = layer_state;
+    state->default_layers = default_layer_state;
+    state->host_leds      = host_keyboard_leds();
+    state->mods           = get_mods();
+    state->suspended      = suspended;
+}
+
+static bool led_frame_state_changed(void) {
+    led_frame_state_t current;
+    led_frame_state_capture(&current, led_task_suspended());
+    return memcmp(&current, &led_frame_state, sizeof(current)) != 0;
+}
+#endif // LED_MATRIX_SKIP_STATIC_FRAMES
+
 static void led_task_sync(void) {
     eeconfig_flush_led_matrix(false);
+#ifdef LED_MATRIX_SKIP_STATIC_FRAMES
+    // keep showing an idle frame until something it depends on changes
+    if (led_frame_idle && !led_redraw_requested && !led_frame_state_changed()) return;
+    led_redraw_requested = false;
+#endif // LED_MATRIX_SKIP_STATIC_FRAMES
     // next task
     if (sync_timer_elapsed32(g_led_timer) >= LED_MATRIX_LED_FLUSH_LIMIT) led_task_state = STARTING;
 }
@@ -270,11 +303,12 @@ static void led_task_start(void) {
 
     // Ideally we would also stop sending zeros to the LED driver PWM buffers
     // while suspended and just do a software shutdown. This is a cheap hack for now.
-    bool suspend_backlight = suspend_state ||
-#if LED_MATRIX_TIMEOUT > 0
-                             (last_input_activity_elapsed() > (uint32_t)LED_MATRIX_TIMEOUT) ||
-#endif // LED_MATRIX_TIMEOUT > 0
-                             false;
+    bool suspend_backlight = led_task_suspended();
+
+#ifdef LED_MATRIX_SKIP_STATIC_FRAMES
+    led_frame_state_capture(&led_frame_state, suspend_backlight);
+    led_effect_params.idle = false;
+#endif // LED_MATRIX_SKIP_STATIC_FRAMES
 
     // Set effect to be renedered
     led_current_effect = suspend_backlight || !led_matrix_eeconfig.enable ? 0 : led_matrix_eeconfig.mode;
@@ -337,6 +371,10 @@ static void led_task_render(uint8_t effect) {
 
     // next task
     if (!rendering) {
+#ifdef LED_MATRIX_SKIP_STATIC_FRAMES
+        // nothing is drawn while the matrix is off, so that frame never changes either
+        led_frame_idle = led_effect_params.idle || effect == LED_MATRIX_NONE;
+#endif // LED_MATRIX_SKIP_STATIC_FRAMES
         led_task_state = FLUSHING;
         if (!led_effect_params.init && effect == LED_MATRIX_NONE) {
             // We only need to flush once if we are LED_MATRIX_NONE
@@ -452,19 +490,18 @@ struct led_matrix_limits_t led_matrix_get_limits(uint8_t iter) {
     return limits;
 }
 
+void led_matrix_request_redraw(void) {
+#ifdef LED_MATRIX_SKIP_STATIC_FRAMES
+    led_redraw_requested = true;
+#endif // LED_MATRIX_SKIP_STATIC_FRAMES
+}
+
 void led_matrix_init(void) {
     led_matrix_driver.init();
 
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
-    g_last_hit_tracker.count = 0;
-    for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
-        g_last_hit_tracker.tick[i] = UINT16_MAX;
-    }
-
-    last_hit_buffer.count = 0;
-    for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
-        last_hit_buffer.tick[i] = UINT16_MAX;
-    }
+    led_hit_tracker_init(&g_last_hit_tracker);
+    led_hit_tracker_init(&last_hit_buffer);
 #endif // LED_MATRIX_KEYREACTIVE_ENABLED
 
     eeconfig_init_led_matrix();
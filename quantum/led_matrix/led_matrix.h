@@ -148,6 +148,9 @@ bool led_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
 void led_matrix_init(void);
 
+// Redraw even if the last frame was idle, for indicators that depend on state the matrix doesn't track
+void led_matrix_request_redraw(void);
+
 void led_matrix_reload_from_eeprom(void);
 
 void        led_matrix_set_suspend_state(bool state);
@@ -45,6 +45,10 @@
 #    include "connection.h"
 #endif
 
+#ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+#    include "pointing_device_transform.h"
+#endif
+
 void nvm_eeconfig_erase(void) {
 #ifdef EEPROM_DRIVER
     eeprom_driver_format(false);
@@ -209,6 +213,15 @@ void nvm_eeconfig_update_connection(const connection_config_t *config) {
 }
 #endif // CONNECTION_ENABLE
 
+#ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+void nvm_eeconfig_read_pointing_device(pointing_device_config_t *config) {
+    config->raw = eeprom_read_dword(EECONFIG_POINTING_DEVICE);
+}
+void nvm_eeconfig_update_pointing_device(const pointing_device_config_t *config) {
+    eeprom_update_dword(EECONFIG_POINTING_DEVICE, config->raw);
+}
+#endif // POINTING_DEVICE_TRANSFORM_ENABLE
+
 bool nvm_eeconfig_read_handedness(void) {
     return !!eeprom_read_byte(EECONFIG_HANDEDNESS);
 }
@@ -16,7 +16,7 @@ static bool validate_driver_vtable(painter_driver_t *driver) {
 }
 
 static bool validate_comms_vtable(painter_driver_t *driver) {
-    return (driver && driver->comms_vtable && driver->comms_vtable->comms_init && driver->comms_vtable->comms_start && driver->comms_vtable->comms_stop && driver->comms_vtable->comms_send) ? true : false;
+    return (driver && driver->comms_vtable && driver->comms_vtable->comms_init && driver->comms_vtable->comms_start && driver->comms_vtable->comms_stop && driver->comms_vtable->comms_send && (!driver->comms_vtable->comms_send_async || driver->comms_vtable->comms_busy)) ? true : false;
 }
 
 static bool validate_driver_integrity(painter_driver_t *driver) {
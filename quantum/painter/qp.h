@@ -56,6 +56,63 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the number of recently used glyphs whose width and data location are remembered, shared between
+ *      all loaded fonts. Repeated characters then skip the lookup in the font's glyph tables, which is most noticeable
+ *      with large unicode fonts stored in flash. Each entry requires 12 bytes of RAM, set to 0 to disable.
+ */
+#    define QUANTUM_PAINTER_GLYPH_CACHE_SIZE 8
+#endif
+
+#ifndef QUANTUM_PAINTER_TEXT_BUFFER_SIZE
+/**
+ * @def This controls the size (in bytes) of the buffer that glyphs are composed into before being sent to the display,
+ *      so that a run of glyphs is sent as a single block instead of one block per glyph. Each pixel uses as many bits
+ *      as the font has, so a 16 pixel high 1bpp font fits 256 pixels of text per block with the default size. Fonts
+ *      with native colors, or glyphs too wide for the buffer, are still sent one glyph at a time. Set to 0 to disable.
+ */
+#    define QUANTUM_PAINTER_TEXT_BUFFER_SIZE 512
+#endif
+
+#ifndef QUANTUM_PAINTER_FLASH_CACHE_LINES
+/**
+ * @def This controls the number of read-ahead cache lines shared by all images and fonts loaded from external flash.
+ *      Each line is filled by a single flash read, so decoding an image sequentially only goes to the flash once per
+ *      \ref QUANTUM_PAINTER_FLASH_CACHE_LINE_SIZE bytes. Only used when a flash driver is enabled.
+ */
+#    define QUANTUM_PAINTER_FLASH_CACHE_LINES 2
+#endif
+
+#ifndef QUANTUM_PAINTER_FLASH_CACHE_LINE_SIZE
+/**
+ * @def This controls the size (in bytes) of each read-ahead cache line for assets in external flash. Larger lines
+ *      mean fewer flash transactions for images and animations, at the cost of RAM and of reading more than needed
+ *      for scattered accesses such as glyph table lookups.
+ */
+#    define QUANTUM_PAINTER_FLASH_CACHE_LINE_SIZE 128
+#endif
+
+#ifndef QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS
+/**
+ * @def This controls the location of the asset directory in external flash, used by \ref qp_load_image_asset and
+ *      \ref qp_load_font_asset to look up images and fonts by name.
+ */
+#    define QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS 0
+#endif
+
+#ifndef QUANTUM_PAINTER_FLASH_SHARES_BUS
+/**
+ * @def This controls whether displays release the bus while assets are read from external flash in the middle of
+ *      drawing. Enabled by default when both the flash and a display use SPI, as they then share the one SPI bus.
+ */
+#    if defined(FLASH_DRIVER_SPI) && defined(QUANTUM_PAINTER_SPI_ENABLE)
+#        define QUANTUM_PAINTER_FLASH_SHARES_BUS 1
+#    else
+#        define QUANTUM_PAINTER_FLASH_SHARES_BUS 0
+#    endif
+#endif
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -72,6 +129,16 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_ASYNC_COMMS
+/**
+ * @def This controls whether pixel data is sent to displays in the background, for comms drivers which support it
+ *      (currently SPI on ChibiOS). A second pixel data buffer is filled while the first one is being transmitted.
+ *      Drawing calls still wait for the final transfer to complete, releasing the bus before they return. Requires an
+ *      extra \ref QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE bytes of RAM.
+ */
+#    define QUANTUM_PAINTER_ASYNC_COMMS FALSE
+#endif
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -103,6 +170,11 @@ typedef const void *painter_device_t;
  */
 typedef enum { QP_ROTATION_0, QP_ROTATION_90, QP_ROTATION_180, QP_ROTATION_270 } painter_rotation_t;
 
+/**
+ * @typedef Which edge of the box text is lined up with. Used as a parameter to \ref qp_drawtext_line.
+ */
+typedef enum { QP_TEXT_ALIGN_LEFT, QP_TEXT_ALIGN_RIGHT } painter_text_align_t;
+
 /**
  * @typedef A descriptor for a Quantum Painter image.
  */
@@ -353,6 +425,31 @@ bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native
  */
 painter_image_handle_t qp_load_image_mem(const void *buffer);
 
+#ifdef FLASH_ENABLE
+/**
+ * Loads an image stored in external flash.
+ *
+ * @note Image data is read from flash as it is drawn, through a small read-ahead cache. Images can be unloaded by
+ *       calling \ref qp_close_image.
+ *
+ * @param address[in] the location of the image in flash
+ * @return an image handle usable with \ref qp_drawimage, \ref qp_drawimage_recolor, \ref qp_animate, and
+ *         \ref qp_animate_recolor.
+ * @return NULL if loading the image failed
+ */
+painter_image_handle_t qp_load_image_flash(uint32_t address);
+
+/**
+ * Loads an image stored in external flash, looking it up by name in the asset directory at
+ * \ref QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS.
+ *
+ * @param name[in] the name of the image, as given when the asset directory was created
+ * @return an image handle, as per \ref qp_load_image_flash
+ * @return NULL if the image could not be found, or loading it failed
+ */
+painter_image_handle_t qp_load_image_asset(const char *name);
+#endif // FLASH_ENABLE
+
 /**
  * Closes an image handle when no longer in use.
  *
@@ -440,6 +537,30 @@ void qp_stop_animation(deferred_token anim_token);
  */
 painter_font_handle_t qp_load_font_mem(const void *buffer);
 
+#ifdef FLASH_ENABLE
+/**
+ * Loads a font stored in external flash.
+ *
+ * @note Font data is read from flash as it is drawn, through a small read-ahead cache, unless
+ *       \ref QUANTUM_PAINTER_LOAD_FONTS_TO_RAM is enabled. Fonts can be unloaded by calling \ref qp_close_font.
+ *
+ * @param address[in] the location of the font in flash
+ * @return a font handle usable with \ref qp_textwidth, \ref qp_drawtext, and \ref qp_drawtext_recolor.
+ * @return NULL if loading the font failed
+ */
+painter_font_handle_t qp_load_font_flash(uint32_t address);
+
+/**
+ * Loads a font stored in external flash, looking it up by name in the asset directory at
+ * \ref QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS.
+ *
+ * @param name[in] the name of the font, as given when the asset directory was created
+ * @return a font handle, as per \ref qp_load_font_flash
+ * @return NULL if the font could not be found, or loading it failed
+ */
+painter_font_handle_t qp_load_font_asset(const char *name);
+#endif // FLASH_ENABLE
+
 /**
  * Closes a font handle when no longer in use.
  *
@@ -488,6 +609,46 @@ int16_t qp_drawtext(painter_device_t device, uint16_t x, uint16_t y, painter_fon
  */
 int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_font_handle_t font, const char *str, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
 
+/**
+ * Draws a line of text within a box on the display, only redrawing the glyphs that changed since the previous call.
+ *
+ * @note Glyphs partially outside the box are clipped. Any part of the box covered by `prev_str` but not by `str` is
+ *       filled with the background color.
+ *
+ * @param device[in] the handle of the device to control
+ * @param left[in] the left edge of the box
+ * @param top[in] the y-position where the text should be drawn onto the device
+ * @param right[in] the right edge of the box
+ * @param font[in] the handle of the font
+ * @param str[in] the string to draw
+ * @param prev_str[in] the string drawn by the previous call with the same box and font, or NULL to draw every glyph
+ * @param align[in] whether the text starts at the left edge, or ends at the right edge of the box
+ * @return the width (in pixels) of the specified string
+ */
+int16_t qp_drawtext_line(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, painter_font_handle_t font, const char *str, const char *prev_str, painter_text_align_t align);
+
+/**
+ * Draws a line of text within a box on the display, recoloring monochrome fonts to the desired foreground/background.
+ * Only the glyphs that changed since the previous call are redrawn.
+ *
+ * @param device[in] the handle of the device to control
+ * @param left[in] the left edge of the box
+ * @param top[in] the y-position where the text should be drawn onto the device
+ * @param right[in] the right edge of the box
+ * @param font[in] the handle of the font
+ * @param str[in] the string to draw
+ * @param prev_str[in] the string drawn by the previous call with the same box, font and colors, or NULL to draw every glyph
+ * @param align[in] whether the text starts at the left edge, or ends at the right edge of the box
+ * @param hue_fg[in] the foreground hue to use, with 0-360 mapped to 0-255
+ * @param sat_fg[in] the foreground saturation to use, with 0-100% mapped to 0-255
+ * @param val_fg[in] the foreground value to use, with 0-100% mapped to 0-255
+ * @param hue_bg[in] the background hue to use, with 0-360 mapped to 0-255
+ * @param sat_bg[in] the background saturation to use, with 0-100% mapped to 0-255
+ * @param val_bg[in] the background value to use, with 0-100% mapped to 0-255
+ * @return the width (in pixels) of the specified string
+ */
+int16_t qp_drawtext_line_recolor(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, painter_font_handle_t font, const char *str, const char *prev_str, painter_text_align_t align, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter Drivers
 
@@ -2,6 +2,50 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "qp_comms.h"
+#include "qp_draw.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Background transfers
+
+#if QUANTUM_PAINTER_ASYNC_COMMS
+// Only one transfer runs in the background at a time, overlapping with the next block of pixel data being prepared
+static painter_device_t async_device = NULL;
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
+
+void qp_comms_wait(void) {
+#if QUANTUM_PAINTER_ASYNC_COMMS
+    if (async_device != NULL) {
+        painter_driver_t *driver = (painter_driver_t *)async_device;
+        while (driver->comms_vtable->comms_busy(async_device)) {
+        }
+        async_device = NULL;
+    }
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Bus sharing
+
+// The device between qp_comms_start and qp_comms_stop, and the one whose comms were stopped by qp_comms_suspend
+static painter_device_t active_device    = NULL;
+static painter_device_t suspended_device = NULL;
+
+void qp_comms_suspend(void) {
+    qp_comms_wait();
+    if (active_device != NULL) {
+        painter_driver_t *driver = (painter_driver_t *)active_device;
+        driver->comms_vtable->comms_stop(active_device);
+        suspended_device = active_device;
+    }
+}
+
+void qp_comms_resume(void) {
+    if (suspended_device != NULL) {
+        painter_driver_t *driver = (painter_driver_t *)suspended_device;
+        driver->comms_vtable->comms_start(suspended_device);
+        suspended_device = NULL;
+    }
+}
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Base comms APIs
@@ -23,7 +67,12 @@ bool qp_comms_start(painter_device_t device) {
         return false;
     }
 
-    return driver->comms_vtable->comms_start(device);
+    qp_comms_wait();
+    if (!driver->comms_vtable->comms_start(device)) {
+        return false;
+    }
+    active_device = device;
+    return true;
 }
 
 void qp_comms_stop(painter_device_t device) {
@@ -33,6 +82,10 @@ void qp_comms_stop(painter_device_t device) {
         return;
     }
 
+    active_device = NULL;
+
+    // The bus is released before drawing returns, as other devices on it may be used before Quantum Painter runs again
+    qp_comms_wait();
     driver->comms_vtable->comms_stop(device);
 }
 
@@ -43,15 +96,40 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
         return false;
     }
 
+    qp_comms_wait();
     return driver->comms_vtable->comms_send(device, data, byte_count);
 }
 
+uint32_t qp_comms_send_async(painter_device_t device, const void *data, uint32_t byte_count) {
+#if QUANTUM_PAINTER_ASYNC_COMMS
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_comms_send_async: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    // Anything other than the pixdata buffer may be on the stack, or get modified once we return
+    if (driver->comms_vtable->comms_send_async == NULL || data != qp_internal_global_pixdata_buffer) {
+        return qp_comms_send(device, data, byte_count);
+    }
+
+    qp_comms_wait();
+    uint32_t ret = driver->comms_vtable->comms_send_async(device, data, byte_count);
+    async_device = device;
+    qp_internal_swap_pixdata_buffer();
+    return ret;
+#else
+    return qp_comms_send(device, data, byte_count);
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
 bool qp_comms_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t                    *driver       = (painter_driver_t *)device;
     painter_comms_with_command_vtable_t *comms_vtable = (painter_comms_with_command_vtable_t *)driver->comms_vtable;
+    qp_comms_wait();
     return comms_vtable->send_command(device, cmd);
 }
 
@@ -68,5 +146,6 @@ uint32_t qp_comms_command_databuf(painter_device_t device, uint8_t cmd, const vo
 bool qp_comms_bulk_command_sequence(painter_device_t device, const uint8_t *sequence, size_t sequence_len) {
     painter_driver_t                    *driver       = (painter_driver_t *)device;
     painter_comms_with_command_vtable_t *comms_vtable = (painter_comms_with_command_vtable_t *)driver->comms_vtable;
+    qp_comms_wait();
     return comms_vtable->bulk_command_sequence(device, sequence, sequence_len);
 }
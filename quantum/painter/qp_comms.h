@@ -16,6 +16,18 @@ bool     qp_comms_start(painter_device_t device);
 void     qp_comms_stop(painter_device_t device);
 uint32_t qp_comms_send(painter_device_t device, const void* data, uint32_t byte_count);
 
+// Sends in the background when QUANTUM_PAINTER_ASYNC_COMMS is enabled, the comms driver supports it, and data is the
+// global pixdata buffer -- which is then swapped for the other one. Otherwise behaves the same as qp_comms_send.
+uint32_t qp_comms_send_async(painter_device_t device, const void* data, uint32_t byte_count);
+
+// Waits for any background transfer to complete
+void qp_comms_wait(void);
+
+// Releases the bus from the device currently drawing, so something else on it (such as external flash) can be used
+// mid-draw, and takes it back again afterwards
+void qp_comms_suspend(void);
+void qp_comms_resume(void);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
@@ -2,6 +2,7 @@
 // Copyright 2023 Pablo Martinez (@elpekenin) <elpekenin@elpekenin.dev>
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
 #include "qp_internal.h"
 #include "qp_draw.h"
 #include "qp_comms.h"
@@ -57,7 +58,7 @@ bool qp_internal_decode_grayscale(painter_device_t device, uint32_t pixel_count,
 bool qp_internal_decode_recolor(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qp_internal_pixel_output_callback output_callback, void* output_arg) {
     painter_driver_t* driver = (painter_driver_t*)device;
     int16_t           steps  = 1 << bits_per_pixel; // number of items we need to interpolate
-    if (qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, steps)) {
+    if (qp_internal_interpolate_palette(device, fg_hsv888, bg_hsv888, steps)) {
         if (!driver->driver_vtable->palette_convert(device, steps, qp_internal_global_pixel_lookup_table)) {
             return false;
         }
@@ -84,6 +85,57 @@ bool qp_internal_send_bytes(painter_device_t device, uint32_t byte_count, qp_int
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Progressive pull of bytes, push of pixels
 
+static uint32_t qp_drawimage_block_rle_decoder(qp_internal_byte_input_state_t* state, uint8_t* buffer, uint32_t length) {
+    uint32_t filled = 0;
+    while (filled < length) {
+        // Work out if we're parsing the initial marker byte
+        if (state->rle.mode == MARKER_BYTE) {
+            int16_t c = qp_stream_get(state->src_stream);
+            if (c < 0) {
+                break;
+            }
+            if (c >= 128) {
+                state->rle.mode   = NON_REPEATING_RUN; // non-repeated run
+                state->rle.remain = c - 127;
+            } else {
+                state->rle.mode   = REPEATING_RUN; // repeated run
+                state->rle.remain = c;
+                state->curr       = qp_stream_get(state->src_stream);
+                if (state->curr < 0) {
+                    break;
+                }
+            }
+        }
+
+        // Copy out as much of the current run as fits
+        uint32_t count = state->rle.remain < (length - filled) ? state->rle.remain : (length - filled);
+        if (state->rle.mode == REPEATING_RUN) {
+            memset(&buffer[filled], state->curr, count);
+        } else if (qp_stream_read(&buffer[filled], 1, count, state->src_stream) != count) {
+            break;
+        }
+        filled += count;
+
+        // Swap back to querying the marker byte mode once the run is complete
+        state->rle.remain -= count;
+        if (state->rle.remain == 0) {
+            state->rle.mode = MARKER_BYTE;
+        }
+    }
+    return filled;
+}
+
+uint32_t qp_internal_read_bytes(qp_internal_byte_input_state_t* input_state, uint8_t* buffer, uint32_t length) {
+    switch (input_state->compression) {
+        case IMAGE_UNCOMPRESSED:
+            return qp_stream_read(buffer, 1, length, input_state->src_stream);
+        case IMAGE_COMPRESSED_RLE:
+            return qp_drawimage_block_rle_decoder(input_state, buffer, length);
+        default:
+            return 0;
+    }
+}
+
 static inline int16_t qp_drawimage_byte_uncompressed_decoder(void* cb_arg) {
     qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
     state->curr                           = qp_stream_get(state->src_stream);
@@ -92,38 +144,8 @@ static inline int16_t qp_drawimage_byte_uncompressed_decoder(void* cb_arg) {
 
 static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
     qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)cb_arg;
-
-    // Work out if we're parsing the initial marker byte
-    if (state->rle.mode == MARKER_BYTE) {
-        uint8_t c = qp_stream_get(state->src_stream);
-        if (c >= 128) {
-            state->rle.mode   = NON_REPEATING_RUN; // non-repeated run
-            state->rle.remain = c - 127;
-        } else {
-            state->rle.mode   = REPEATING_RUN; // repeated run
-            state->rle.remain = c;
-        }
-
-        state->curr = qp_stream_get(state->src_stream);
-    }
-
-    // Work out which byte we're returning
-    uint8_t c = state->curr;
-
-    // Decrement the counter of the bytes remaining
-    state->rle.remain--;
-
-    if (state->rle.remain > 0) {
-        // If we're in a non-repeating run, queue up the next byte
-        if (state->rle.mode == NON_REPEATING_RUN) {
-            state->curr = qp_stream_get(state->src_stream);
-        }
-    } else {
-        // Swap back to querying the marker byte mode
-        state->rle.mode = MARKER_BYTE;
-    }
-
-    return c;
+    uint8_t                         c;
+    return qp_drawimage_block_rle_decoder(state, &c, 1) == 1 ? c : STREAM_EOF;
 }
 
 bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
@@ -165,46 +187,150 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
     return true;
 }
 
-// Helper shared between image and font rendering -- uses either (qp_internal_decode_palette + qp_internal_pixel_appender) or (qp_internal_send_bytes) to send data data to the display based on the asset's native-ness
-bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state) {
-    painter_driver_t* driver = (painter_driver_t*)device;
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Block decoding of pixel data
+
+// Number of pixels (or native bytes) decoded at a time, a multiple of the pixels per byte of every supported bpp
+#define QP_INTERNAL_DECODE_BLOCK_PIXELS 64
+
+// Splits packed palette indices into one byte per pixel, LSb first pixel
+static inline void qp_internal_unpack_indices(uint8_t bpp, const uint8_t* src, uint32_t byte_count, uint8_t* dst) {
+    switch (bpp) {
+        case 1:
+            for (uint32_t i = 0; i < byte_count; ++i, dst += 8) {
+                uint8_t b = src[i];
+                dst[0]    = (b >> 0) & 0x01;
+                dst[1]    = (b >> 1) & 0x01;
+                dst[2]    = (b >> 2) & 0x01;
+                dst[3]    = (b >> 3) & 0x01;
+                dst[4]    = (b >> 4) & 0x01;
+                dst[5]    = (b >> 5) & 0x01;
+                dst[6]    = (b >> 6) & 0x01;
+                dst[7]    = (b >> 7) & 0x01;
+            }
+            break;
+        case 2:
+            for (uint32_t i = 0; i < byte_count; ++i, dst += 4) {
+                uint8_t b = src[i];
+                dst[0]    = (b >> 0) & 0x03;
+                dst[1]    = (b >> 2) & 0x03;
+                dst[2]    = (b >> 4) & 0x03;
+                dst[3]    = (b >> 6) & 0x03;
+            }
+            break;
+        case 4:
+            for (uint32_t i = 0; i < byte_count; ++i, dst += 2) {
+                uint8_t b = src[i];
+                dst[0]    = b & 0x0F;
+                dst[1]    = b >> 4;
+            }
+            break;
+        case 8:
+            memcpy(dst, src, byte_count);
+            break;
+    }
+}
+
+// Decodes palette indices a block at a time, converting them to native pixels in the pixdata buffer
+static bool qp_internal_append_palette_pixels(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_state_t* input_state) {
+    painter_driver_t* driver          = (painter_driver_t*)device;
+    const uint8_t     pixels_per_byte = 8 / bpp;
+    const uint32_t    max_pixels      = qp_internal_num_pixels_in_buffer(device);
+    uint32_t          write_pos       = 0;
+    uint8_t           packed[QP_INTERNAL_DECODE_BLOCK_PIXELS];
+    uint8_t           indices[QP_INTERNAL_DECODE_BLOCK_PIXELS];
+
+    while (pixel_count > 0) {
+        // Don't read past the last byte of the asset, the final byte may only be partially used
+        uint32_t block_pixels = pixel_count < QP_INTERNAL_DECODE_BLOCK_PIXELS ? pixel_count : QP_INTERNAL_DECODE_BLOCK_PIXELS;
+        uint32_t block_bytes  = (block_pixels + pixels_per_byte - 1) / pixels_per_byte;
+        if (qp_internal_read_bytes(input_state, packed, block_bytes) != block_bytes) {
+            return false;
+        }
+        qp_internal_unpack_indices(bpp, packed, block_bytes, indices);
+
+        // Convert to native pixels, sending the buffer whenever it fills up
+        uint32_t done = 0;
+        while (done < block_pixels) {
+            uint32_t count = block_pixels - done;
+            if (count > max_pixels - write_pos) {
+                count = max_pixels - write_pos;
+            }
+            if (!driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, qp_internal_global_pixel_lookup_table, write_pos, count, &indices[done])) {
+                return false;
+            }
+            write_pos += count;
+            done += count;
+
+            if (write_pos == max_pixels) {
+                if (!driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, write_pos)) {
+                    return false;
+                }
+                write_pos = 0;
+            }
+        }
+
+        pixel_count -= block_pixels;
+    }
 
-    bool ret = false;
+    // Any leftovers need transmission as well.
+    return write_pos == 0 || driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, write_pos);
+}
+
+// Copies native pixel data a block at a time into the pixdata buffer
+static bool qp_internal_append_native_pixels(painter_device_t device, uint32_t byte_count, qp_internal_byte_input_state_t* input_state) {
+    painter_driver_t* driver    = (painter_driver_t*)device;
+    const uint32_t    max_bytes = qp_internal_num_pixels_in_buffer(device) * driver->native_bits_per_pixel / 8;
+    uint32_t          write_pos = 0;
+    uint8_t           block[QP_INTERNAL_DECODE_BLOCK_PIXELS];
+
+    while (byte_count > 0) {
+        uint32_t block_bytes = byte_count < sizeof(block) ? byte_count : sizeof(block);
+        if (qp_internal_read_bytes(input_state, block, block_bytes) != block_bytes) {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < block_bytes; ++i) {
+            if (!driver->driver_vtable->append_pixdata(device, qp_internal_global_pixdata_buffer, write_pos++, block[i])) {
+                return false;
+            }
+
+            // If we've hit the transmit limit, send out the entire buffer and reset the write position
+            if (write_pos == max_bytes) {
+                if (!driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, write_pos * 8 / driver->native_bits_per_pixel)) {
+                    return false;
+                }
+                write_pos = 0;
+            }
+        }
+
+        byte_count -= block_bytes;
+    }
+
+    // Any leftovers need transmission as well.
+    return write_pos == 0 || driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, write_pos * 8 / driver->native_bits_per_pixel);
+}
+
+// Helper shared between image and font rendering -- sends data to the display based on the asset's native-ness
+bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_state_t* input_state) {
+    painter_driver_t* driver = (painter_driver_t*)device;
 
     // Non-native pixel format
     if (bpp <= 8) {
-        // Set up the output state
-        qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
-
-        // Decode the pixel data and stream to the display
-        ret = qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
-        // Any leftovers need transmission as well.
-        if (ret && output_state.pixel_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
-        }
+        return qp_internal_append_palette_pixels(device, bpp, pixel_count, input_state);
     }
 
     // Native pixel format
-    else if (bpp != driver->native_bits_per_pixel) {
+    if (bpp != driver->native_bits_per_pixel) {
         qp_dprintf("Asset's bpp (%d) doesn't match the target display's native_bits_per_pixel (%d)\n", bpp, driver->native_bits_per_pixel);
         return false;
-    } else {
-        // Set up the output state
-        qp_internal_byte_output_state_t output_state = {.device = device, .byte_write_pos = 0, .max_bytes = qp_internal_num_pixels_in_buffer(device) * driver->native_bits_per_pixel / 8};
-
-        // Stream the raw pixel data to the display
-        uint32_t byte_count = pixel_count * bpp / 8;
-        ret                 = qp_internal_send_bytes(device, byte_count, input_callback, input_state, qp_internal_byte_appender, &output_state);
-        // Any leftovers need transmission as well.
-        if (ret && output_state.byte_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
-        }
     }
 
-    return ret;
+    return qp_internal_append_native_pixels(device, pixel_count * bpp / 8, input_state);
 }
 
 qp_internal_byte_input_callback qp_internal_prepare_input_state(qp_internal_byte_input_state_t* input_state, painter_compression_t compression) {
+    input_state->compression = compression;
     switch (compression) {
         case IMAGE_UNCOMPRESSED:
             return qp_drawimage_byte_uncompressed_decoder;
@@ -20,12 +20,19 @@ STATIC_ASSERT((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE > 0) && (QUANTUM_PAINTER_PIXD
 //       **** very likely get artifacts rendered to the screen as a result.                                       ****
 //
 
-// Buffer used for transmitting native pixel data to the downstream device.
-__attribute__((__aligned__(4))) uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+// Buffers used for transmitting native pixel data to the downstream device. When sending asynchronously, one is filled
+// while the other one is still being transmitted.
+#if QUANTUM_PAINTER_ASYNC_COMMS
+__attribute__((__aligned__(4))) static uint8_t pixdata_buffers[2][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#else
+__attribute__((__aligned__(4))) static uint8_t pixdata_buffers[1][QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
+#endif
+uint8_t *qp_internal_global_pixdata_buffer = pixdata_buffers[0];
 
 // Static buffer to contain a generated color palette
 static bool                                       generated_palette = false;
 static int16_t                                    generated_steps   = -1;
+static painter_device_t                           generated_device  = NULL;
 __attribute__((__aligned__(4))) static qp_pixel_t interpolated_fg_hsv888;
 __attribute__((__aligned__(4))) static qp_pixel_t interpolated_bg_hsv888;
 #if QUANTUM_PAINTER_SUPPORTS_256_PALETTE
@@ -37,6 +44,12 @@ __attribute__((__aligned__(4))) qp_pixel_t qp_internal_global_pixel_lookup_table
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helpers
 
+#if QUANTUM_PAINTER_ASYNC_COMMS
+void qp_internal_swap_pixdata_buffer(void) {
+    qp_internal_global_pixdata_buffer = (qp_internal_global_pixdata_buffer == pixdata_buffers[0]) ? pixdata_buffers[1] : pixdata_buffers[0];
+}
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
+
 uint32_t qp_internal_num_pixels_in_buffer(painter_device_t device) {
     painter_driver_t *driver = (painter_driver_t *)device;
     return ((QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE * 8) / driver->native_bits_per_pixel);
@@ -63,19 +76,27 @@ void qp_internal_fill_pixdata(painter_device_t device, uint32_t num_pixels, uint
     for (uint32_t i = 0; i < num_pixels; ++i) {
         driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, &color, i, 1, &palette_idx);
     }
+
+#if QUANTUM_PAINTER_ASYNC_COMMS
+    // The same pixels get sent repeatedly, so both buffers need them. The other one may still be in flight.
+    qp_comms_wait();
+    uint8_t *other = (qp_internal_global_pixdata_buffer == pixdata_buffers[0]) ? pixdata_buffers[1] : pixdata_buffers[0];
+    memcpy(other, qp_internal_global_pixdata_buffer, (num_pixels * driver->native_bits_per_pixel + 7) / 8);
+#endif // QUANTUM_PAINTER_ASYNC_COMMS
 }
 
-// Resets the global palette so that it can be regenerated. Only needed if the colors are identical, but a different display is used with a different internal pixel format.
+// Resets the global palette so that it can be regenerated. Needed if the lookup table has been used for anything else.
 void qp_internal_invalidate_palette(void) {
     generated_palette = false;
     generated_steps   = -1;
+    generated_device  = NULL;
 }
 
 // Interpolates between two colors to generate a palette
-bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
+bool qp_internal_interpolate_palette(painter_device_t device, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, int16_t steps) {
     // Check if we need to generate a new palette -- if the input parameters match then assume the palette can stay unchanged.
-    // This may present a problem if using the same parameters but a different screen converts pixels -- use qp_internal_invalidate_palette() to reset.
-    if (generated_palette == true && generated_steps == steps && memcmp(&interpolated_fg_hsv888, &fg_hsv888, sizeof(fg_hsv888)) == 0 && memcmp(&interpolated_bg_hsv888, &bg_hsv888, sizeof(bg_hsv888)) == 0) {
+    // A different device may convert to a different native format, so the palette is regenerated for each device.
+    if (generated_palette == true && generated_device == device && generated_steps == steps && memcmp(&interpolated_fg_hsv888, &fg_hsv888, sizeof(fg_hsv888)) == 0 && memcmp(&interpolated_bg_hsv888, &bg_hsv888, sizeof(bg_hsv888)) == 0) {
         // We already have the correct palette, no point regenerating it.
         return false;
     }
@@ -83,6 +104,7 @@ bool qp_internal_interpolate_palette(qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888,
     // Save the parameters so we know whether we can skip generation
     generated_palette      = true;
     generated_steps        = steps;
+    generated_device       = device;
     interpolated_fg_hsv888 = fg_hsv888;
     interpolated_bg_hsv888 = bg_hsv888;
 
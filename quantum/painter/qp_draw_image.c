@@ -5,6 +5,7 @@
 #include "qp_draw.h"
 #include "qp_comms.h"
 #include "qgf.h"
+#include "qpa.h"
 #include "deferred_exec.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -19,6 +20,9 @@ typedef struct qgf_image_handle_t {
 #ifdef QP_STREAM_HAS_FILE_IO
         qp_file_stream_t file_stream;
 #endif // QP_STREAM_HAS_FILE_IO
+#ifdef FLASH_ENABLE
+        qp_flash_stream_t flash_stream;
+#endif // FLASH_ENABLE
     };
 } qgf_image_handle_t;
 
@@ -85,6 +89,39 @@ painter_image_handle_t qp_load_image_mem(const void *buffer) {
     return qp_load_image_internal(image_mem_stream_factory, (void *)buffer);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_image_flash
+
+#ifdef FLASH_ENABLE
+
+static inline bool image_flash_stream_factory(qgf_image_handle_t *image, void *arg) {
+    uint32_t address = *(uint32_t *)arg;
+
+    // Assume we can read the graphics descriptor
+    image->flash_stream = qp_make_flash_stream(address, sizeof(qgf_graphics_descriptor_v1_t));
+
+    // Update the length of the stream to match, and rewind to the start
+    image->flash_stream.length   = qgf_get_total_size(&image->stream);
+    image->flash_stream.position = 0;
+
+    return true;
+}
+
+painter_image_handle_t qp_load_image_flash(uint32_t address) {
+    return qp_load_image_internal(image_flash_stream_factory, &address);
+}
+
+painter_image_handle_t qp_load_image_asset(const char *name) {
+    uint32_t address;
+    if (!qpa_find_flash_asset(name, &address)) {
+        qp_dprintf("qp_load_image_asset: fail (could not find '%s')\n", name);
+        return NULL;
+    }
+    return qp_load_image_flash(address);
+}
+
+#endif // FLASH_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_close_image
 
@@ -122,9 +159,37 @@ typedef struct qgf_frame_info_t {
     uint16_t              right;
     uint16_t              bottom;
     uint16_t              delay;
+    uint32_t              end_position; // stream position just after the frame's pixel data
 } qgf_frame_info_t;
 
-static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device, qgf_image_handle_t *qgf_image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qgf_frame_info_t *info) {
+// Carried between the frames of an animation, so each frame doesn't have to start from scratch
+typedef struct qgf_frame_cache_t {
+    uint16_t   next_frame;          // frame expected to start at next_frame_position
+    uint32_t   next_frame_position; // 0 if unknown
+    uint8_t    palette_bpp;         // bpp of the generated palette below, 0 if none
+    qp_pixel_t palette[16];         // native palette generated from the fg/bg colors
+} qgf_frame_cache_t;
+
+// Seeks to the descriptor of the requested frame, and reads it
+static bool qp_drawimage_read_frame_descriptor(qgf_image_handle_t *qgf_image, uint16_t frame_number, qgf_frame_cache_t *cache, qgf_frame_v1_t *frame_descriptor) {
+    // Frames are stored back to back, so the previous frame usually tells us where this one starts
+    if (cache && cache->next_frame_position != 0 && cache->next_frame == frame_number) {
+        qp_stream_setpos(&qgf_image->stream, cache->next_frame_position);
+        if (qp_stream_read(frame_descriptor, sizeof(qgf_frame_v1_t), 1, &qgf_image->stream) == 1 && qgf_validate_block_header(&frame_descriptor->header, QGF_FRAME_DESCRIPTOR_TYPEID, sizeof(qgf_frame_v1_t) - sizeof(qgf_block_header_v1_t))) {
+            return true;
+        }
+    }
+
+    // Otherwise look it up in the frame offset table
+    qgf_seek_to_frame_descriptor(&qgf_image->stream, frame_number);
+    if (qp_stream_read(frame_descriptor, sizeof(qgf_frame_v1_t), 1, &qgf_image->stream) != 1) {
+        qp_dprintf("Failed to read frame_descriptor, expected length was not %d\n", (int)sizeof(qgf_frame_v1_t));
+        return false;
+    }
+    return true;
+}
+
+static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device, qgf_image_handle_t *qgf_image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qgf_frame_info_t *info, qgf_frame_cache_t *cache) {
     painter_driver_t *driver = (painter_driver_t *)device;
 
     // Drop out if we can't actually place the data we read out anywhere
@@ -133,13 +198,9 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         return false;
     }
 
-    // Seek to the frame
-    qgf_seek_to_frame_descriptor(&qgf_image->stream, frame_number);
-
-    // Read the frame descriptor
+    // Seek to the frame, and read the frame descriptor
     qgf_frame_v1_t frame_descriptor;
-    if (qp_stream_read(&frame_descriptor, sizeof(qgf_frame_v1_t), 1, &qgf_image->stream) != 1) {
-        qp_dprintf("Failed to read frame_descriptor, expected length was not %d\n", (int)sizeof(qgf_frame_v1_t));
+    if (!qp_drawimage_read_frame_descriptor(qgf_image, frame_number, cache, &frame_descriptor)) {
         return false;
     }
 
@@ -153,7 +214,6 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
 
     if (!qp_internal_bpp_capable(info->bpp)) {
         qp_dprintf("qp_drawimage_recolor: fail (image bpp too high (%d), check QUANTUM_PAINTER_SUPPORTS_256_PALETTE or QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS)\n", (int)info->bpp);
-        qp_comms_stop(device);
         return false;
     }
 
@@ -167,10 +227,13 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         }
 
         needs_pixconvert = true;
+    } else if (cache && cache->palette_bpp == info->bpp) {
+        // Reuse the palette generated for a previous frame
+        memcpy(qp_internal_global_pixel_lookup_table, cache->palette, palette_entries * sizeof(qp_pixel_t));
     } else {
         if (info->bpp <= 8) {
             // Interpolate from fg/bg
-            needs_pixconvert = qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, palette_entries);
+            needs_pixconvert = qp_internal_interpolate_palette(device, fg_hsv888, bg_hsv888, palette_entries);
         }
     }
 
@@ -178,9 +241,13 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         // Convert the palette to native format
         if (!driver->driver_vtable->palette_convert(device, palette_entries, qp_internal_global_pixel_lookup_table)) {
             qp_dprintf("qp_drawimage_recolor: fail (could not convert pixels to native)\n");
-            qp_comms_stop(device);
             return false;
         }
+
+        if (cache && !info->has_palette && palette_entries <= ARRAY_SIZE(cache->palette)) {
+            memcpy(cache->palette, qp_internal_global_pixel_lookup_table, palette_entries * sizeof(qp_pixel_t));
+            cache->palette_bpp = info->bpp;
+        }
     }
 
     // Handle delta if needed
@@ -203,33 +270,19 @@ static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device,
         qp_dprintf("Failed to read data_descriptor, expected length was not %d\n", (int)sizeof(qgf_data_v1_t));
         return false;
     }
+    info->end_position = qp_stream_tell(&qgf_image->stream) + data_descriptor.header.length;
 
     // Stream is now at the point of being able to read pixdata
     return true;
 }
 
-static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, int frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
-    qp_dprintf("qp_drawimage_recolor: entry\n");
+// Draws a single frame of the image, comms need to be started by the caller
+static bool qp_drawimage_frame(painter_device_t device, uint16_t x, uint16_t y, qgf_image_handle_t *qgf_image, uint16_t frame_number, qgf_frame_info_t *frame_info, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qgf_frame_cache_t *cache) {
     painter_driver_t *driver = (painter_driver_t *)device;
-    if (!driver || !driver->validate_ok) {
-        qp_dprintf("qp_drawimage_recolor: fail (validation_ok == false)\n");
-        return false;
-    }
-
-    qgf_image_handle_t *qgf_image = (qgf_image_handle_t *)image;
-    if (!qgf_image || !qgf_image->validate_ok) {
-        qp_dprintf("qp_drawimage_recolor: fail (invalid image)\n");
-        return false;
-    }
 
     // Read the frame info
-    if (!qp_drawimage_prepare_frame_for_stream_read(device, qgf_image, frame_number, fg_hsv888, bg_hsv888, frame_info)) {
-        qp_dprintf("qp_drawimage_recolor: fail (could not read frame %d)\n", frame_number);
-        return false;
-    }
-
-    if (!qp_comms_start(device)) {
-        qp_dprintf("qp_drawimage_recolor: fail (could not start comms)\n");
+    if (!qp_drawimage_prepare_frame_for_stream_read(device, qgf_image, frame_number, fg_hsv888, bg_hsv888, frame_info, cache)) {
+        qp_dprintf("qp_drawimage_recolor: fail (could not read frame %d)\n", (int)frame_number);
         return false;
     }
 
@@ -242,29 +295,58 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
     } else {
         l = x;
         t = y;
-        r = x + image->width - 1;
-        b = y + image->height - 1;
+        r = x + qgf_image->base.width - 1;
+        b = y + qgf_image->base.height - 1;
     }
     uint32_t pixel_count = ((uint32_t)(r - l + 1)) * (b - t + 1);
 
     // Configure where we're going to be rendering to
     if (!driver->driver_vtable->viewport(device, l, t, r, b)) {
         qp_dprintf("qp_drawimage_recolor: fail (could not set viewport)\n");
-        qp_comms_stop(device);
         return false;
     }
 
     // Set up the input state
-    qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qgf_image->stream};
-    qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, frame_info->compression_scheme);
-    if (input_callback == NULL) {
+    qp_internal_byte_input_state_t input_state = {.device = device, .src_stream = &qgf_image->stream};
+    if (qp_internal_prepare_input_state(&input_state, frame_info->compression_scheme) == NULL) {
         qp_dprintf("qp_drawimage_recolor: fail (invalid image compression scheme)\n");
-        qp_comms_stop(device);
         return false;
     }
 
     // Decode and stream pixels
-    bool ret = qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state);
+    if (!qp_internal_appender(device, frame_info->bpp, pixel_count, &input_state)) {
+        return false;
+    }
+
+    // Remember where the next frame starts
+    if (cache) {
+        cache->next_frame          = frame_number + 1;
+        cache->next_frame_position = frame_info->end_position;
+    }
+    return true;
+}
+
+static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    qp_dprintf("qp_drawimage_recolor: entry\n");
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_drawimage_recolor: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    qgf_image_handle_t *qgf_image = (qgf_image_handle_t *)image;
+    if (!qgf_image || !qgf_image->validate_ok) {
+        qp_dprintf("qp_drawimage_recolor: fail (invalid image)\n");
+        return false;
+    }
+
+    if (!qp_comms_start(device)) {
+        qp_dprintf("qp_drawimage_recolor: fail (could not start comms)\n");
+        return false;
+    }
+
+    qgf_frame_info_t frame_info = {0};
+    bool             ret        = qp_drawimage_frame(device, x, y, qgf_image, 0, &frame_info, fg_hsv888, bg_hsv888, NULL);
 
     qp_dprintf("qp_drawimage_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
@@ -272,10 +354,9 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
 }
 
 bool qp_drawimage_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
-    qgf_frame_info_t frame_info = {0};
-    qp_pixel_t       fg_hsv888  = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
-    qp_pixel_t       bg_hsv888  = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    return qp_drawimage_recolor_impl(device, x, y, image, 0, &frame_info, fg_hsv888, bg_hsv888);
+    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
+    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+    return qp_drawimage_recolor_impl(device, x, y, image, fg_hsv888, bg_hsv888);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -287,6 +368,9 @@ deferred_token qp_animate(painter_device_t device, uint16_t x, uint16_t y, paint
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_animate_recolor
+//
+// Animations aren't scheduled individually -- every animation that's due is rendered by the same tick, grouped by
+// device so that comms only need to be started once per display.
 
 typedef struct animation_state_t {
     painter_device_t       device;
@@ -296,41 +380,90 @@ typedef struct animation_state_t {
     qp_pixel_t             fg_hsv888;
     qp_pixel_t             bg_hsv888;
     uint16_t               frame_number;
-    deferred_token         defer_token;
+    uint32_t               next_frame_time;
+    deferred_token         token;
+    qgf_frame_cache_t      cache;
 } animation_state_t;
 
-static deferred_executor_t animation_executors[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS] = {0};
-static animation_state_t   animation_states[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS]    = {0};
+static animation_state_t animation_states[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS] = {0};
+static deferred_token    last_animation_token                                    = INVALID_DEFERRED_TOKEN;
+
+// Reads the delay of a frame, and whether it's a delta from the previous one, without decoding it
+static bool qp_peek_animation_frame(animation_state_t *state, uint16_t frame_number, uint16_t *delay, bool *is_delta) {
+    qgf_image_handle_t *qgf_image = (qgf_image_handle_t *)state->image;
+    qgf_frame_v1_t      frame_descriptor;
+    uint8_t             bpp;
+    bool                has_palette, is_panel_native;
+    return qp_drawimage_read_frame_descriptor(qgf_image, frame_number, &state->cache, &frame_descriptor) && qgf_parse_frame_descriptor(&frame_descriptor, &bpp, &has_palette, &is_panel_native, is_delta, NULL, delay);
+}
+
+// When rendering has fallen behind, skips frames that the following frame completely redraws anyway. If the next frame
+// is a delta it can't be skipped, so the schedule is restarted instead of trying to catch up.
+static void qp_skip_late_animation_frames(animation_state_t *state, uint32_t now) {
+    for (uint16_t i = 0; i < state->image->frame_count && timer_expired32(now, state->next_frame_time); ++i) {
+        uint16_t following = (state->frame_number + 1) % state->image->frame_count;
+        uint16_t delay, unused;
+        bool     is_delta;
+        if (!qp_peek_animation_frame(state, state->frame_number, &delay, &is_delta) || !qp_peek_animation_frame(state, following, &unused, &is_delta)) {
+            return;
+        }
+
+        // The current frame is still on time
+        uint32_t following_time = state->next_frame_time + delay;
+        if (!timer_expired32(now, following_time)) {
+            return;
+        }
+
+        if (is_delta) {
+            state->next_frame_time = now;
+            return;
+        }
+
+        qp_dprintf("qp_animation: skipping frame #%d\n", (int)state->frame_number);
+        state->frame_number = following;
+        state->next_frame_time += delay;
+    }
+}
+
+// Whether a running animation holds the token
+static bool qp_animation_token_in_use(deferred_token token) {
+    for (int i = 0; i < QUANTUM_PAINTER_CONCURRENT_ANIMATIONS; ++i) {
+        if (animation_states[i].device != NULL && animation_states[i].token == token) {
+            return true;
+        }
+    }
+    return false;
+}
 
-static deferred_token qp_render_animation_state(animation_state_t *state, uint16_t *delay_ms) {
+// Renders the current frame of the animation, comms need to be started by the caller
+static bool qp_render_animation_state(animation_state_t *state) {
     qgf_frame_info_t frame_info = {0};
     qp_dprintf("qp_render_animation_state: entry (frame #%d)\n", (int)state->frame_number);
-    bool ret = qp_drawimage_recolor_impl(state->device, state->x, state->y, state->image, state->frame_number, &frame_info, state->fg_hsv888, state->bg_hsv888);
+    bool ret = qp_drawimage_frame(state->device, state->x, state->y, (qgf_image_handle_t *)state->image, state->frame_number, &frame_info, state->fg_hsv888, state->bg_hsv888, &state->cache);
     if (ret) {
         ++state->frame_number;
         if (state->frame_number >= state->image->frame_count) {
             state->frame_number = 0;
         }
-        *delay_ms = frame_info.delay;
+        state->next_frame_time += frame_info.delay;
     }
-    qp_dprintf("qp_render_animation_state: %s (delay %dms)\n", ret ? "ok" : "fail", (int)(*delay_ms));
+    qp_dprintf("qp_render_animation_state: %s (delay %dms)\n", ret ? "ok" : "fail", (int)frame_info.delay);
     return ret;
 }
 
-static uint32_t animation_callback(uint32_t trigger_time, void *cb_arg) {
-    animation_state_t *state    = (animation_state_t *)cb_arg;
-    uint16_t           delay_ms = 0;
-    bool               ret      = qp_render_animation_state(state, &delay_ms);
-    if (!ret) {
-        // Setting the device to NULL clears the animation slot
-        state->device = NULL;
-    }
-    // If we're successful, keep animating -- returning 0 cancels the deferred execution
-    return ret ? delay_ms : 0;
-}
-
 deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t y, painter_image_handle_t image, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
     qp_dprintf("qp_animate_recolor: entry\n");
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_animate_recolor: fail (validation_ok == false)\n");
+        return INVALID_DEFERRED_TOKEN;
+    }
+
+    qgf_image_handle_t *qgf_image = (qgf_image_handle_t *)image;
+    if (!qgf_image || !qgf_image->validate_ok) {
+        qp_dprintf("qp_animate_recolor: fail (invalid image)\n");
+        return INVALID_DEFERRED_TOKEN;
+    }
 
     animation_state_t *anim_state = NULL;
     for (int i = 0; i < QUANTUM_PAINTER_CONCURRENT_ANIMATIONS; ++i) {
@@ -346,32 +479,40 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
     }
 
     // Prepare the animation state
-    anim_state->device       = device;
-    anim_state->x            = x;
-    anim_state->y            = y;
-    anim_state->image        = image;
-    anim_state->fg_hsv888    = (qp_pixel_t){.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
-    anim_state->bg_hsv888    = (qp_pixel_t){.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    anim_state->frame_number = 0;
+    uint32_t now = timer_read32();
+    *anim_state  = (animation_state_t){
+        .device          = device,
+        .x               = x,
+        .y               = y,
+        .image           = image,
+        .fg_hsv888       = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}},
+        .bg_hsv888       = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}},
+        .frame_number    = 0,
+        .next_frame_time = now,
+    };
 
     // Draw the first frame
-    uint16_t delay_ms;
-    if (!qp_render_animation_state(anim_state, &delay_ms)) {
+    if (!qp_comms_start(device)) {
         anim_state->device = NULL; // disregard the allocated animation slot
-        qp_dprintf("qp_animate_recolor: fail (could not render first frame)\n");
+        qp_dprintf("qp_animate_recolor: fail (could not start comms)\n");
         return INVALID_DEFERRED_TOKEN;
     }
-
-    // Set up the timer
-    anim_state->defer_token = defer_exec_advanced(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, delay_ms, animation_callback, anim_state);
-    if (anim_state->defer_token == INVALID_DEFERRED_TOKEN) {
+    bool ret = qp_render_animation_state(anim_state);
+    qp_comms_stop(device);
+    if (!ret) {
         anim_state->device = NULL; // disregard the allocated animation slot
-        qp_dprintf("qp_animate_recolor: fail (could not set up animation executor)\n");
+        qp_dprintf("qp_animate_recolor: fail (could not render first frame)\n");
         return INVALID_DEFERRED_TOKEN;
     }
 
-    qp_dprintf("qp_animate_recolor: ok (deferred token = %d)\n", (int)anim_state->defer_token);
-    return anim_state->defer_token;
+    // Hand out a token that's unique amongst the running animations, as the counter wraps around
+    do {
+        ++last_animation_token;
+    } while (last_animation_token == INVALID_DEFERRED_TOKEN || qp_animation_token_in_use(last_animation_token));
+    anim_state->token = last_animation_token;
+
+    qp_dprintf("qp_animate_recolor: ok (deferred token = %d)\n", (int)anim_state->token);
+    return anim_state->token;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -379,8 +520,7 @@ deferred_token qp_animate_recolor(painter_device_t device, uint16_t x, uint16_t
 
 void qp_stop_animation(deferred_token anim_token) {
     for (int i = 0; i < QUANTUM_PAINTER_CONCURRENT_ANIMATIONS; ++i) {
-        if (animation_states[i].defer_token == anim_token) {
-            cancel_deferred_exec_advanced(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, anim_token);
+        if (animation_states[i].device != NULL && animation_states[i].token == anim_token) {
             animation_states[i].device = NULL;
             return;
         }
@@ -391,6 +531,33 @@ void qp_stop_animation(deferred_token anim_token) {
 // Quantum Painter Core API: qp_internal_animation_tick
 
 void qp_internal_animation_tick(void) {
-    static uint32_t last_anim_exec = 0;
-    deferred_exec_advanced_task(animation_executors, QUANTUM_PAINTER_CONCURRENT_ANIMATIONS, &last_anim_exec);
+    uint32_t now = timer_read32();
+    bool     due[QUANTUM_PAINTER_CONCURRENT_ANIMATIONS];
+    for (int i = 0; i < QUANTUM_PAINTER_CONCURRENT_ANIMATIONS; ++i) {
+        due[i] = animation_states[i].device != NULL && timer_expired32(now, animation_states[i].next_frame_time);
+    }
+
+    for (int i = 0; i < QUANTUM_PAINTER_CONCURRENT_ANIMATIONS; ++i) {
+        if (!due[i]) {
+            continue;
+        }
+
+        // Render everything that's due on this device in one go
+        painter_device_t device = animation_states[i].device;
+        if (!qp_comms_start(device)) {
+            qp_dprintf("qp_internal_animation_tick: fail (could not start comms)\n");
+            continue;
+        }
+        for (int j = i; j < QUANTUM_PAINTER_CONCURRENT_ANIMATIONS; ++j) {
+            if (due[j] && animation_states[j].device == device) {
+                due[j] = false;
+                qp_skip_late_animation_frames(&animation_states[j], now);
+                if (!qp_render_animation_state(&animation_states[j])) {
+                    // Setting the device to NULL clears the animation slot
+                    animation_states[j].device = NULL;
+                }
+            }
+        }
+        qp_comms_stop(device);
+    }
 }
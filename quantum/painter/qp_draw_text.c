@@ -8,6 +8,7 @@
 #include "qp_draw.h"
 #include "qp_comms.h"
 #include "qff.h"
+#include "qpa.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QFF font handles
@@ -17,6 +18,9 @@ typedef struct qff_font_handle_t {
     bool                  validate_ok;
     bool                  has_ascii_table;
     uint16_t              num_unicode_glyphs;
+    bool                  has_sorted_unicode_table;
+    uint32_t              unicode_table_offset; // location of the first unicode glyph entry
+    uint32_t              glyph_data_offset;    // location of the first byte of glyph pixel data
     uint8_t               bpp;
     bool                  has_palette;
     bool                  is_panel_native;
@@ -27,6 +31,9 @@ typedef struct qff_font_handle_t {
 #ifdef QP_STREAM_HAS_FILE_IO
         qp_file_stream_t file_stream;
 #endif // QP_STREAM_HAS_FILE_IO
+#ifdef FLASH_ENABLE
+        qp_flash_stream_t flash_stream;
+#endif // FLASH_ENABLE
     };
 #if QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
     bool  owns_buffer;
@@ -36,6 +43,49 @@ typedef struct qff_font_handle_t {
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Glyph cache
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+typedef struct qff_glyph_cache_entry_t {
+    qff_font_handle_t *font;
+    uint32_t           code_point : 24;
+    uint32_t           width : 8;
+    uint32_t           data_offset;
+} qff_glyph_cache_entry_t;
+
+// Most recently used glyph first
+static qff_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_GLYPH_CACHE_SIZE] = {0};
+
+static bool qp_glyph_cache_find(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width, uint32_t *data_offset) {
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_SIZE; ++i) {
+        if (glyph_cache[i].font == qff_font && glyph_cache[i].code_point == code_point) {
+            qff_glyph_cache_entry_t entry = glyph_cache[i];
+            memmove(&glyph_cache[1], &glyph_cache[0], i * sizeof(qff_glyph_cache_entry_t));
+            glyph_cache[0] = entry;
+            *width         = entry.width;
+            *data_offset   = entry.data_offset;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void qp_glyph_cache_insert(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint32_t data_offset) {
+    // Drop the least recently used glyph
+    memmove(&glyph_cache[1], &glyph_cache[0], (QUANTUM_PAINTER_GLYPH_CACHE_SIZE - 1) * sizeof(qff_glyph_cache_entry_t));
+    glyph_cache[0] = (qff_glyph_cache_entry_t){.font = qff_font, .code_point = code_point, .width = width, .data_offset = data_offset};
+}
+
+static void qp_glyph_cache_evict(qff_font_handle_t *qff_font) {
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_GLYPH_CACHE_SIZE; ++i) {
+        if (glyph_cache[i].font == qff_font) {
+            glyph_cache[i].font = NULL;
+        }
+    }
+}
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load font from stream
 
@@ -73,21 +123,25 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
     font->owns_buffer = false;
     font->buffer      = NULL;
 
-    void *ram_buffer = malloc(font->mem_stream.length);
+    // Works for any stream, so fonts in external flash can be copied too
+    uint32_t font_size  = qff_get_total_size(&font->stream);
+    void    *ram_buffer = malloc(font_size);
     if (ram_buffer == NULL) {
         qp_dprintf("qp_load_font: could not allocate enough RAM for font, falling back to original\n");
     } else {
         do {
             // Copy the data into RAM
-            if (qp_stream_read(ram_buffer, 1, font->mem_stream.length, &font->mem_stream) != font->mem_stream.length) {
+            qp_stream_setpos(&font->stream, 0);
+            if (qp_stream_read(ram_buffer, 1, font_size, &font->stream) != font_size) {
                 qp_dprintf("qp_load_font: could not copy from flash to RAM, falling back to original\n");
                 break;
             }
 
             // Create the new stream with the new buffer
+            qp_stream_close(&font->stream);
             font->buffer      = ram_buffer;
             font->owns_buffer = true;
-            font->mem_stream  = qp_make_memory_stream(font->buffer, font->mem_stream.length);
+            font->mem_stream  = qp_make_memory_stream(font->buffer, font_size);
         } while (0);
     }
 
@@ -98,7 +152,17 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
     // Read the info (parsing already successful above, no need to check return value)
-    qff_read_font_descriptor(&font->stream, &font->base.line_height, &font->has_ascii_table, &font->num_unicode_glyphs, &font->bpp, &font->has_palette, &font->is_panel_native, &font->compression_scheme, NULL);
+    qff_read_font_descriptor(&font->stream, &font->base.line_height, &font->has_ascii_table, &font->num_unicode_glyphs, &font->has_sorted_unicode_table, &font->bpp, &font->has_palette, &font->is_panel_native, &font->compression_scheme, NULL);
+
+    // Work out where the glyph tables and data start once, instead of for every glyph
+    font->unicode_table_offset = sizeof(qff_font_descriptor_v1_t)                                   // Skip the font descriptor
+                                 + (font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
+                                 + sizeof(qgf_block_header_v1_t);                                   // Skip the unicode block header
+    font->glyph_data_offset = sizeof(qff_font_descriptor_v1_t)                                                                                                           // Skip the font descriptor
+                              + (font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                         // Skip the ascii table
+                              + (font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
+                              + (font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
+                              + sizeof(qgf_block_header_v1_t);                                                                                                           // Skip the data block header
 
     if (!qp_internal_bpp_capable(font->bpp)) {
         qp_dprintf("qp_load_font: fail (image bpp too high (%d), check QUANTUM_PAINTER_SUPPORTS_256_PALETTE or QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS)\n", (int)font->bpp);
@@ -132,6 +196,39 @@ painter_font_handle_t qp_load_font_mem(const void *buffer) {
     return qp_load_font_internal(font_mem_stream_factory, (void *)buffer);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_load_font_flash
+
+#ifdef FLASH_ENABLE
+
+static inline bool font_flash_stream_factory(qff_font_handle_t *font, void *arg) {
+    uint32_t address = *(uint32_t *)arg;
+
+    // Assume we can read the font descriptor
+    font->flash_stream = qp_make_flash_stream(address, sizeof(qff_font_descriptor_v1_t));
+
+    // Update the length of the stream to match, and rewind to the start
+    font->flash_stream.length   = qff_get_total_size(&font->stream);
+    font->flash_stream.position = 0;
+
+    return true;
+}
+
+painter_font_handle_t qp_load_font_flash(uint32_t address) {
+    return qp_load_font_internal(font_flash_stream_factory, &address);
+}
+
+painter_font_handle_t qp_load_font_asset(const char *name) {
+    uint32_t address;
+    if (!qpa_find_flash_asset(name, &address)) {
+        qp_dprintf("qp_load_font_asset: fail (could not find '%s')\n", name);
+        return NULL;
+    }
+    return qp_load_font_flash(address);
+}
+
+#endif // FLASH_ENABLE
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_close_font
 
@@ -151,6 +248,11 @@ bool qp_close_font(painter_font_handle_t font) {
     }
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    // Forget any glyphs from this font, the handle may be reused for another
+    qp_glyph_cache_evict(qff_font);
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
     // Free up this font for use elsewhere.
     qp_stream_close(&qff_font->stream);
     qff_font->validate_ok = false;
@@ -198,7 +300,7 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     } else {
         // Interpolate from fg/bg
         int16_t palette_entries = 1 << qff_font->bpp;
-        needs_pixconvert        = qp_internal_interpolate_palette(fg_hsv888, bg_hsv888, palette_entries);
+        needs_pixconvert        = qp_internal_interpolate_palette(device, fg_hsv888, bg_hsv888, palette_entries);
     }
 
     if (needs_pixconvert) {
@@ -214,7 +316,10 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     return true;
 }
 
-static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
+// Helper that reads a glyph's width and data location from one of the font's glyph tables
+static bool qp_drawtext_lookup_glyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width, uint32_t *data_offset) {
+    uint32_t glyph_value;
+
     if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
         // Do ascii table
         qff_ascii_glyph_v1_t glyph_info;
@@ -231,69 +336,99 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
             return false;
         }
 
-        uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-        uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-        uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                               + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                               + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                               + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                               + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                               + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-        if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing ascii glyph data\n");
-            return false;
+        glyph_value = glyph_info.value;
+    } else if (qff_font->has_sorted_unicode_table) {
+        // Binary search the unicode table, which may include singular ascii glyphs if full ascii table isn't specified
+        qff_unicode_glyph_v1_t glyph_info;
+        uint16_t               lo = 0;
+        uint16_t               hi = qff_font->num_unicode_glyphs;
+        while (true) {
+            if (lo >= hi) {
+                qp_dprintf("Failed to find unicode glyph info\n");
+                return false;
+            }
+
+            uint16_t mid = lo + (hi - lo) / 2;
+            if (qp_stream_setpos(&qff_font->stream, qff_font->unicode_table_offset + mid * sizeof(qff_unicode_glyph_v1_t)) < 0) {
+                qp_dprintf("Failed to set stream position while searching unicode glyph info\n");
+                return false;
+            }
+
+            if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+                qp_dprintf("Failed to read unicode glyph info\n");
+                return false;
+            }
+
+            if (glyph_info.code_point == code_point) {
+                break;
+            } else if (glyph_info.code_point < code_point) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
         }
 
-        *width = glyph_width;
-        return true;
+        glyph_value = glyph_info.value;
     } else {
-        // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified
-        uint32_t glyph_info_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
-                                     + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
-                                     + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
-
-        if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
+        // Fonts generated without a sorted unicode table need a linear scan
+        if (qp_stream_setpos(&qff_font->stream, qff_font->unicode_table_offset) < 0) {
             qp_dprintf("Failed to set stream position while preparing glyph data\n");
             return false;
         }
 
         qff_unicode_glyph_v1_t glyph_info;
-        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
+        uint16_t               i;
+        for (i = 0; i < qff_font->num_unicode_glyphs; ++i) {
             if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
                 qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
                 return false;
             }
 
             if (glyph_info.code_point == code_point) {
-                uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-                uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-                uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                                       + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                                       + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                                       + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                                       + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                                       + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-                if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-                    qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
-                    return false;
-                }
-
-                *width = glyph_width;
-                return true;
+                break;
             }
         }
 
-        // Not found
-        qp_dprintf("Failed to find unicode glyph info\n");
+        if (i == qff_font->num_unicode_glyphs) {
+            qp_dprintf("Failed to find unicode glyph info\n");
+            return false;
+        }
+
+        glyph_value = glyph_info.value;
+    }
+
+    *width       = (uint8_t)(glyph_value & QFF_GLYPH_WIDTH_MASK);
+    *data_offset = qff_font->glyph_data_offset + ((glyph_value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
+    return true;
+}
+
+// Helper that finds a glyph, optionally leaving the stream at the start of its pixel data
+static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, bool seek_to_data, uint8_t *width) {
+    uint32_t data_offset;
+
+#if QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    if (!qp_glyph_cache_find(qff_font, code_point, width, &data_offset)) {
+        if (!qp_drawtext_lookup_glyph(qff_font, code_point, width, &data_offset)) {
+            return false;
+        }
+        qp_glyph_cache_insert(qff_font, code_point, *width, data_offset);
+    }
+#else  // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+    if (!qp_drawtext_lookup_glyph(qff_font, code_point, width, &data_offset)) {
         return false;
     }
-    return false;
+#endif // QUANTUM_PAINTER_GLYPH_CACHE_SIZE > 0
+
+    if (seek_to_data && qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
+        qp_dprintf("Failed to set stream position while preparing glyph data\n");
+        return false;
+    }
+
+    return true;
 }
 
 // Function to iterate over each UTF8 codepoint, invoking the callback for each decoded glyph
-static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const char *str, code_point_handler handler, void *cb_arg) {
+static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const char *str, bool seek_to_data, code_point_handler handler, void *cb_arg) {
     while (*str) {
         int32_t code_point = 0;
         str                = decode_utf8(str, &code_point);
@@ -303,7 +438,7 @@ static inline bool qp_iterate_code_points(qff_font_handle_t *qff_font, const cha
         }
 
         uint8_t width;
-        if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, &width)) {
+        if (!qp_drawtext_prepare_glyph_for_render(qff_font, code_point, seek_to_data, &width)) {
             qp_dprintf("Failed to prepare glyph for rendering.\n");
             return false;
         }
@@ -337,36 +472,270 @@ static inline bool qp_font_code_point_handler_calcwidth(qff_font_handle_t *qff_f
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // String drawing implementation
 
+#if QUANTUM_PAINTER_TEXT_BUFFER_SIZE > 0
+// Palette indices of the glyphs waiting to be sent, packed at the font's bpp, with rows of `batch_stride` pixels
+static uint8_t qp_text_buffer[QUANTUM_PAINTER_TEXT_BUFFER_SIZE];
+#endif // QUANTUM_PAINTER_TEXT_BUFFER_SIZE > 0
+
 // Callback state
 typedef struct code_point_iter_drawglyph_state_t {
-    painter_device_t                  device;
-    int16_t                           xpos;
-    int16_t                           ypos;
-    qp_internal_byte_input_callback   input_callback;
-    qp_internal_byte_input_state_t   *input_state;
-    qp_internal_pixel_output_state_t *output_state;
+    painter_device_t                device;
+    int16_t                         xpos;
+    int16_t                         ypos;
+    qp_internal_byte_input_state_t *input_state;
+    // Only the columns between these are drawn
+    int16_t clip_left;
+    int16_t clip_right;
+    // The previously drawn string, positioned after the glyph at prev_xpos. NULL once there are no more glyphs.
+    const char *prev_str;
+    int16_t     prev_xpos;
+    int32_t     prev_code_point;
+    uint8_t     prev_width;
+#if QUANTUM_PAINTER_TEXT_BUFFER_SIZE > 0
+    // Glyphs composed into the text buffer, but not yet sent
+    int16_t  batch_left;
+    uint16_t batch_width;
+    uint16_t batch_stride;
+#endif // QUANTUM_PAINTER_TEXT_BUFFER_SIZE > 0
 } code_point_iter_drawglyph_state_t;
 
+// Moves on to the next glyph of the previously drawn string
+static void qp_drawtext_next_prev_glyph(qff_font_handle_t *qff_font, code_point_iter_drawglyph_state_t *state) {
+    if (*state->prev_str == 0) {
+        state->prev_str = NULL;
+        return;
+    }
+
+    state->prev_str = decode_utf8(state->prev_str, &state->prev_code_point);
+    if (state->prev_code_point < 0 || !qp_drawtext_prepare_glyph_for_render(qff_font, state->prev_code_point, false, &state->prev_width)) {
+        // Treat everything from here on as changed
+        state->prev_str = NULL;
+    }
+}
+
+// Checks whether the previously drawn string had the same glyph at the same position
+static bool qp_drawtext_glyph_unchanged(qff_font_handle_t *qff_font, code_point_iter_drawglyph_state_t *state, uint32_t code_point, int16_t xpos) {
+    // Looking up glyphs moves the stream, which is already positioned at this glyph's data
+    uint32_t data_offset = qp_stream_tell(&qff_font->stream);
+    while (state->prev_str != NULL && state->prev_xpos < xpos) {
+        state->prev_xpos += state->prev_width;
+        qp_drawtext_next_prev_glyph(qff_font, state);
+    }
+    qp_stream_setpos(&qff_font->stream, data_offset);
+
+    return state->prev_str != NULL && state->prev_xpos == xpos && state->prev_code_point == (int32_t)code_point;
+}
+
+#if QUANTUM_PAINTER_TEXT_BUFFER_SIZE > 0
+// Decodes the glyph's palette indices into the text buffer, to the right of the glyphs already there
+static bool qp_drawtext_compose_glyph(qff_font_handle_t *qff_font, code_point_iter_drawglyph_state_t *state, uint8_t width, uint8_t height) {
+    const uint8_t  bpp          = qff_font->bpp;
+    const uint8_t  mask         = (1 << bpp) - 1;
+    const uint32_t pixel_count  = ((uint32_t)width) * height;
+    uint32_t       pixel        = 0;
+    uint8_t        x            = 0;
+    uint32_t       buffer_index = state->batch_width;
+    uint8_t        packed[32];
+
+    while (pixel < pixel_count) {
+        uint32_t byte_count = ((pixel_count - pixel) * bpp + 7) / 8;
+        if (byte_count > sizeof(packed)) {
+            byte_count = sizeof(packed);
+        }
+        if (qp_internal_read_bytes(state->input_state, packed, byte_count) != byte_count) {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < byte_count; ++i) {
+            uint8_t byteval = packed[i];
+            for (uint8_t q = 0; q < 8 && pixel < pixel_count; q += bpp, ++pixel) {
+                uint32_t bit   = (buffer_index + x) * bpp;
+                uint8_t  shift = bit & 7;
+
+                qp_text_buffer[bit / 8] = (qp_text_buffer[bit / 8] & ~(mask << shift)) | ((byteval & mask) << shift);
+                byteval >>= bpp;
+                if (++x == width) {
+                    x = 0;
+                    buffer_index += state->batch_stride;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+// Sends the glyphs in the text buffer to the display, as a single block
+static bool qp_drawtext_flush_batch(qff_font_handle_t *qff_font, code_point_iter_drawglyph_state_t *state) {
+    painter_driver_t *driver = (painter_driver_t *)state->device;
+    if (state->batch_width == 0) {
+        return true;
+    }
+
+    // Only send the columns inside the clipping area
+    int16_t first = state->clip_left > state->batch_left ? state->clip_left - state->batch_left : 0;
+    int16_t last  = state->batch_width - 1;
+    if (state->batch_left + last > state->clip_right) {
+        last = state->clip_right - state->batch_left;
+    }
+    state->batch_width = 0;
+    if (first > last) {
+        return true;
+    }
+
+    const uint8_t  bpp        = qff_font->bpp;
+    const uint8_t  mask       = (1 << bpp) - 1;
+    const uint8_t  height     = qff_font->base.line_height;
+    const uint32_t max_pixels = qp_internal_num_pixels_in_buffer(state->device);
+    uint32_t       write_pos  = 0;
+    uint8_t        count      = 0;
+    uint8_t        indices[64];
+
+    driver->driver_vtable->viewport(state->device, state->batch_left + first, state->ypos, state->batch_left + last, state->ypos + height - 1);
+    for (uint8_t y = 0; y < height; ++y) {
+        for (int16_t x = first; x <= last; ++x) {
+            uint32_t bit     = ((uint32_t)y * state->batch_stride + x) * bpp;
+            indices[count++] = (qp_text_buffer[bit / 8] >> (bit & 7)) & mask;
+
+            // Convert to native pixels whenever the indices or the pixdata buffer fill up
+            if (count == sizeof(indices) || write_pos + count == max_pixels || (y == height - 1 && x == last)) {
+                if (!driver->driver_vtable->append_pixels(state->device, qp_internal_global_pixdata_buffer, qp_internal_global_pixel_lookup_table, write_pos, count, indices)) {
+                    return false;
+                }
+                write_pos += count;
+                count = 0;
+
+                if (write_pos == max_pixels) {
+                    if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, write_pos)) {
+                        return false;
+                    }
+                    write_pos = 0;
+                }
+            }
+        }
+    }
+
+    // Any leftovers need transmission as well.
+    return write_pos == 0 || driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, write_pos);
+}
+#endif // QUANTUM_PAINTER_TEXT_BUFFER_SIZE > 0
+
 // Codepoint handler callback: drawing
 static inline bool qp_font_code_point_handler_drawglyph(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t width, uint8_t height, void *cb_arg) {
     code_point_iter_drawglyph_state_t *state  = (code_point_iter_drawglyph_state_t *)cb_arg;
     painter_driver_t                  *driver = (painter_driver_t *)state->device;
 
+    // Move the x-position for the next glyph
+    int16_t xpos = state->xpos;
+    state->xpos += width;
+
+    // Glyphs outside the clipping area, or identical to the one drawn there before, are skipped
+    bool skip = (xpos + width - 1 < state->clip_left) || (xpos > state->clip_right);
+    if (!skip && state->prev_str != NULL) {
+        skip = qp_drawtext_glyph_unchanged(qff_font, state, code_point, xpos);
+    }
+
     // Reset the input state's RLE mode -- the stream should already be correctly positioned by qp_iterate_code_points()
     state->input_state->rle.mode = MARKER_BYTE; // ignored if not using RLE
 
-    // Reset the output state
-    state->output_state->pixel_write_pos = 0;
+#if QUANTUM_PAINTER_TEXT_BUFFER_SIZE > 0
+    // Batches only hold neighbouring glyphs, so anything skipped ends the current one
+    if (skip) {
+        return qp_drawtext_flush_batch(qff_font, state);
+    }
 
-    // Configure where we're going to be rendering to
-    driver->driver_vtable->viewport(state->device, state->xpos, state->ypos, state->xpos + width - 1, state->ypos + height - 1);
+    if (width <= state->batch_stride) {
+        if (state->batch_width + width > state->batch_stride && !qp_drawtext_flush_batch(qff_font, state)) {
+            return false;
+        }
+        if (state->batch_width == 0) {
+            state->batch_left = xpos;
+        }
+        if (!qp_drawtext_compose_glyph(qff_font, state, width, height)) {
+            return false;
+        }
+        state->batch_width += width;
+        return true;
+    }
 
-    // Move the x-position for the next glyph
-    state->xpos += width;
+    // The glyph doesn't fit in the text buffer, send it on its own
+    if (!qp_drawtext_flush_batch(qff_font, state)) {
+        return false;
+    }
+#else  // QUANTUM_PAINTER_TEXT_BUFFER_SIZE > 0
+    if (skip) {
+        return true;
+    }
+#endif // QUANTUM_PAINTER_TEXT_BUFFER_SIZE > 0
+
+    // Glyphs sent on their own can't be clipped, so partially visible ones are left out
+    if (xpos < state->clip_left || xpos + width - 1 > state->clip_right) {
+        return true;
+    }
+
+    // Configure where we're going to be rendering to
+    driver->driver_vtable->viewport(state->device, xpos, state->ypos, xpos + width - 1, state->ypos + height - 1);
 
     // Decode the pixel data for the glyph, and stream it
     uint32_t pixel_count = ((uint32_t)width) * height;
-    return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_callback, state->input_state);
+    return qp_internal_appender(state->device, qff_font->bpp, pixel_count, state->input_state);
+}
+
+// Draws the string with its first glyph at xpos, only touching the columns between clip_left and clip_right.
+// Returns the x-position after the last glyph, or INT16_MIN on failure.
+static int16_t qp_drawtext_impl(painter_device_t device, qff_font_handle_t *qff_font, int16_t xpos, uint16_t y, int16_t clip_left, int16_t clip_right, const char *str, const char *prev_str, int16_t prev_xpos, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    if (!qp_comms_start(device)) {
+        qp_dprintf("qp_drawtext_impl: fail (could not start comms)\n");
+        return INT16_MIN;
+    }
+
+    // Set up the byte input state
+    qp_internal_byte_input_state_t input_state = {.device = device, .src_stream = &qff_font->stream};
+    if (qp_internal_prepare_input_state(&input_state, qff_font->compression_scheme) == NULL) {
+        qp_dprintf("qp_drawtext_impl: fail (invalid font compression scheme)\n");
+        qp_comms_stop(device);
+        return INT16_MIN;
+    }
+
+    // Set up the codepoint iteration state
+    code_point_iter_drawglyph_state_t state = {// Common
+                                               .device = device,
+                                               .xpos   = xpos,
+                                               .ypos   = y,
+                                               // Input
+                                               .input_state = &input_state,
+                                               // Clipping
+                                               .clip_left  = clip_left,
+                                               .clip_right = clip_right,
+                                               // Previous string
+                                               .prev_str  = prev_str,
+                                               .prev_xpos = prev_xpos};
+    if (state.prev_str != NULL) {
+        qp_drawtext_next_prev_glyph(qff_font, &state);
+    }
+
+#if QUANTUM_PAINTER_TEXT_BUFFER_SIZE > 0
+    // Native pixel fonts are always sent a glyph at a time
+    if (qff_font->bpp <= 8) {
+        state.batch_stride = (QUANTUM_PAINTER_TEXT_BUFFER_SIZE * 8 / qff_font->bpp) / qff_font->base.line_height;
+    }
+#endif // QUANTUM_PAINTER_TEXT_BUFFER_SIZE > 0
+
+    uint32_t data_offset;
+    if (!qp_drawtext_prepare_font_for_render(device, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
+        qp_dprintf("qp_drawtext_impl: fail (failed to prepare font for rendering)\n");
+        qp_comms_stop(device);
+        return INT16_MIN;
+    }
+
+    // Iterate the codepoints with the drawglyph callback
+    bool ret = qp_iterate_code_points(qff_font, str, true, qp_font_code_point_handler_drawglyph, &state);
+#if QUANTUM_PAINTER_TEXT_BUFFER_SIZE > 0
+    ret = ret && qp_drawtext_flush_batch(qff_font, &state);
+#endif // QUANTUM_PAINTER_TEXT_BUFFER_SIZE > 0
+
+    qp_comms_stop(device);
+    return ret ? state.xpos : INT16_MIN;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -382,7 +751,8 @@ int16_t qp_textwidth(painter_font_handle_t font, const char *str) {
     // Create the codepoint iterator state
     code_point_iter_calcwidth_state_t state = {.width = 0};
     // Iterate each codepoint, return the calculated width if successful.
-    return qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_calcwidth, &state) ? state.width : 0;
+    // Only the glyph widths are needed, so the stream doesn't need to be moved to each glyph's data.
+    return qp_iterate_code_points(qff_font, str, false, qp_font_code_point_handler_calcwidth, &state) ? state.width : 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -411,47 +781,74 @@ int16_t qp_drawtext_recolor(painter_device_t device, uint16_t x, uint16_t y, pai
         return false;
     }
 
-    if (!qp_comms_start(device)) {
-        qp_dprintf("qp_drawtext_recolor: fail (could not start comms)\n");
+    qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
+    qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
+    int16_t    end       = qp_drawtext_impl(device, qff_font, x, y, x, INT16_MAX, str, NULL, 0, fg_hsv888, bg_hsv888);
+
+    qp_dprintf("qp_drawtext_recolor: %s\n", end != INT16_MIN ? "ok" : "fail");
+    return end != INT16_MIN ? (end - x) : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_drawtext_line
+
+int16_t qp_drawtext_line(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, painter_font_handle_t font, const char *str, const char *prev_str, painter_text_align_t align) {
+    // Offload to the recolor variant, substituting fg=white bg=black.
+    return qp_drawtext_line_recolor(device, left, top, right, font, str, prev_str, align, 0, 0, 255, 0, 0, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_drawtext_line_recolor
+
+int16_t qp_drawtext_line_recolor(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, painter_font_handle_t font, const char *str, const char *prev_str, painter_text_align_t align, uint8_t hue_fg, uint8_t sat_fg, uint8_t val_fg, uint8_t hue_bg, uint8_t sat_bg, uint8_t val_bg) {
+    qp_dprintf("qp_drawtext_line_recolor: entry\n");
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_drawtext_line_recolor: fail (validation_ok == false)\n");
         return 0;
     }
 
-    // Set up the byte input state and input callback
-    qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qff_font->stream};
-    qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, qff_font->compression_scheme);
-    if (input_callback == NULL) {
-        qp_dprintf("qp_drawtext_recolor: fail (invalid font compression scheme)\n");
-        qp_comms_stop(device);
-        return false;
+    qff_font_handle_t *qff_font = (qff_font_handle_t *)font;
+    if (!qff_font || !qff_font->validate_ok) {
+        qp_dprintf("qp_drawtext_line_recolor: fail (invalid font)\n");
+        return 0;
     }
 
-    // Set up the pixel output state
-    qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
-
-    // Set up the codepoint iteration state
-    code_point_iter_drawglyph_state_t state = {// Common
-                                               .device = device,
-                                               .xpos   = x,
-                                               .ypos   = y,
-                                               // Input
-                                               .input_callback = input_callback,
-                                               .input_state    = &input_state,
-                                               // Output
-                                               .output_state = &output_state};
+    // Work out where both strings start
+    int16_t width      = qp_textwidth(font, str);
+    int16_t xpos       = align == QP_TEXT_ALIGN_RIGHT ? right + 1 - width : left;
+    int16_t prev_width = prev_str != NULL ? qp_textwidth(font, prev_str) : 0;
+    int16_t prev_xpos  = align == QP_TEXT_ALIGN_RIGHT ? right + 1 - prev_width : left;
 
     qp_pixel_t fg_hsv888 = {.hsv888 = {.h = hue_fg, .s = sat_fg, .v = val_fg}};
     qp_pixel_t bg_hsv888 = {.hsv888 = {.h = hue_bg, .s = sat_bg, .v = val_bg}};
-    uint32_t   data_offset;
-    if (!qp_drawtext_prepare_font_for_render(driver, qff_font, fg_hsv888, bg_hsv888, &data_offset)) {
-        qp_dprintf("qp_drawtext_recolor: fail (failed to prepare font for rendering)\n");
-        qp_comms_stop(device);
-        return false;
+    if (qp_drawtext_impl(device, qff_font, xpos, top, left, right, str, prev_str, prev_xpos, fg_hsv888, bg_hsv888) == INT16_MIN) {
+        qp_dprintf("qp_drawtext_line_recolor: fail\n");
+        return 0;
     }
 
-    // Iterate the codepoints with the drawglyph callback
-    bool ret = qp_iterate_code_points(qff_font, str, qp_font_code_point_handler_drawglyph, &state);
+    // Clear whatever the previous string covered on either side of this one
+    uint16_t bottom = top + qff_font->base.line_height - 1;
+    int16_t  l      = prev_xpos > left ? prev_xpos : left;
+    int16_t  r      = (xpos < prev_xpos + prev_width ? xpos : prev_xpos + prev_width) - 1;
+    if (r > right) {
+        r = right;
+    }
+    if (l <= r && !qp_rect(device, l, top, r, bottom, hue_bg, sat_bg, val_bg, true)) {
+        return 0;
+    }
+    l = (xpos + width > prev_xpos ? xpos + width : prev_xpos);
+    r = prev_xpos + prev_width - 1;
+    if (l < left) {
+        l = left;
+    }
+    if (r > right) {
+        r = right;
+    }
+    if (l <= r && !qp_rect(device, l, top, r, bottom, hue_bg, sat_bg, val_bg, true)) {
+        return 0;
+    }
 
-    qp_dprintf("qp_drawtext_recolor: %s\n", ret ? "ok" : "fail");
-    qp_comms_stop(device);
-    return ret ? (state.xpos - x) : 0;
+    qp_dprintf("qp_drawtext_line_recolor: ok\n");
+    return width;
 }
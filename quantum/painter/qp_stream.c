@@ -1,12 +1,18 @@
 // Copyright 2021 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
 #include "qp_stream.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Stream API
 
 uint32_t qp_stream_read_impl(void *output_buf, uint32_t member_size, uint32_t num_members, qp_stream_t *stream) {
+    // Use the stream's bulk read if it has one
+    if (stream->read) {
+        return stream->read(stream, output_buf, num_members * member_size) / member_size;
+    }
+
     uint8_t *output_ptr = (uint8_t *)output_buf;
 
     uint32_t i;
@@ -47,6 +53,18 @@ static inline int16_t mem_get(qp_stream_t *stream) {
     return s->buffer[s->position++];
 }
 
+static inline uint32_t mem_read(qp_stream_t *stream, void *output_buf, uint32_t length) {
+    qp_memory_stream_t *s         = (qp_memory_stream_t *)stream;
+    uint32_t            available = s->position < s->length ? (uint32_t)(s->length - s->position) : 0;
+    if (length > available) {
+        s->is_eof = true;
+        length    = available;
+    }
+    memcpy(output_buf, &s->buffer[s->position], length);
+    s->position += length;
+    return length;
+}
+
 static inline bool mem_put(qp_stream_t *stream, uint8_t c) {
     qp_memory_stream_t *s = (qp_memory_stream_t *)stream;
     if (s->position >= s->length) {
@@ -111,7 +129,7 @@ static inline void mem_close(qp_stream_t *stream) {
 
 qp_memory_stream_t qp_make_memory_stream(void *buffer, int32_t length) {
     qp_memory_stream_t stream = {
-        .base     = {.get = mem_get, .put = mem_put, .seek = mem_seek, .tell = mem_tell, .is_eof = mem_is_eof, .close = mem_close},
+        .base     = {.get = mem_get, .read = mem_read, .put = mem_put, .seek = mem_seek, .tell = mem_tell, .is_eof = mem_is_eof, .close = mem_close},
         .buffer   = (uint8_t *)buffer,
         .length   = length,
         .position = 0,
@@ -131,6 +149,11 @@ static inline int16_t file_get(qp_stream_t *stream) {
     return (uint16_t)c;
 }
 
+static inline uint32_t file_read(qp_stream_t *stream, void *output_buf, uint32_t length) {
+    qp_file_stream_t *s = (qp_file_stream_t *)stream;
+    return (uint32_t)fread(output_buf, 1, length, s->file);
+}
+
 static inline bool file_put(qp_stream_t *stream, uint8_t c) {
     qp_file_stream_t *s = (qp_file_stream_t *)stream;
     return fputc(c, s->file) == c;
@@ -158,9 +181,199 @@ static inline void file_close(qp_stream_t *stream) {
 
 qp_file_stream_t qp_make_file_stream(FILE *f) {
     qp_file_stream_t stream = {
-        .base = {.get = file_get, .put = file_put, .seek = file_seek, .tell = file_tell, .is_eof = file_is_eof, .close = file_close},
+        .base = {.get = file_get, .read = file_read, .put = file_put, .seek = file_seek, .tell = file_tell, .is_eof = file_is_eof, .close = file_close},
         .file = f,
     };
     return stream;
 }
 #endif // QP_STREAM_HAS_FILE_IO
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// External flash streams
+
+#ifdef FLASH_ENABLE
+
+#    include "flash.h"
+#    if QUANTUM_PAINTER_FLASH_SHARES_BUS
+#        include "qp_comms.h"
+#    endif // QUANTUM_PAINTER_FLASH_SHARES_BUS
+
+// Read-ahead cache, shared by all flash streams. Lines are tagged with their flash address, so streams over the same
+// asset -- or an asset and the directory it was found in -- share whatever has already been read.
+typedef struct qp_flash_cache_line_t {
+    uint32_t address;  // flash address of data[0]
+    uint16_t length;   // 0 if the line is empty
+    uint16_t last_use; // for picking the least recently used line to refill
+    uint8_t  data[QUANTUM_PAINTER_FLASH_CACHE_LINE_SIZE];
+} qp_flash_cache_line_t;
+
+static qp_flash_cache_line_t flash_cache[QUANTUM_PAINTER_FLASH_CACHE_LINES] = {0};
+static uint16_t              flash_cache_uses                               = 0;
+
+static bool flash_read_range_shared(uint32_t address, void *buf, size_t len) {
+#    if QUANTUM_PAINTER_FLASH_SHARES_BUS
+    // Displays hold on to the bus until they're done drawing, so it has to be borrowed back for the read
+    qp_comms_suspend();
+#    endif // QUANTUM_PAINTER_FLASH_SHARES_BUS
+    bool ok = flash_read_range(address, buf, len) == FLASH_STATUS_SUCCESS;
+#    if QUANTUM_PAINTER_FLASH_SHARES_BUS
+    qp_comms_resume();
+#    endif // QUANTUM_PAINTER_FLASH_SHARES_BUS
+    return ok;
+}
+
+static inline bool flash_cache_line_holds(qp_flash_cache_line_t *line, uint32_t address) {
+    return line->length > 0 && address >= line->address && address - line->address < line->length;
+}
+
+static qp_flash_cache_line_t *flash_cache_find(qp_flash_stream_t *s, uint32_t address) {
+    qp_flash_cache_line_t *line = (qp_flash_cache_line_t *)s->line;
+    if (line == NULL || !flash_cache_line_holds(line, address)) {
+        line = NULL;
+        for (uint8_t i = 0; i < QUANTUM_PAINTER_FLASH_CACHE_LINES; ++i) {
+            if (flash_cache_line_holds(&flash_cache[i], address)) {
+                line = &flash_cache[i];
+                break;
+            }
+        }
+        if (line == NULL) {
+            return NULL;
+        }
+    }
+    line->last_use = ++flash_cache_uses;
+    s->line        = line;
+    return line;
+}
+
+// Reads ahead from the requested location up to the end of the stream, into the least recently used line
+static qp_flash_cache_line_t *flash_cache_fill(qp_flash_stream_t *s, uint32_t address) {
+    qp_flash_cache_line_t *line = &flash_cache[0];
+    for (uint8_t i = 1; i < QUANTUM_PAINTER_FLASH_CACHE_LINES; ++i) {
+        if ((uint16_t)(flash_cache_uses - flash_cache[i].last_use) > (uint16_t)(flash_cache_uses - line->last_use)) {
+            line = &flash_cache[i];
+        }
+    }
+
+    uint32_t end    = s->address + s->length;
+    uint32_t length = end - address < QUANTUM_PAINTER_FLASH_CACHE_LINE_SIZE ? end - address : QUANTUM_PAINTER_FLASH_CACHE_LINE_SIZE;
+    line->length    = 0;
+    if (!flash_read_range_shared(address, line->data, length)) {
+        return NULL;
+    }
+    line->address  = address;
+    line->length   = length;
+    line->last_use = ++flash_cache_uses;
+    s->line        = line;
+    return line;
+}
+
+static inline uint32_t flash_read(qp_stream_t *stream, void *output_buf, uint32_t length) {
+    qp_flash_stream_t *s         = (qp_flash_stream_t *)stream;
+    uint32_t           available = s->position < s->length ? (uint32_t)(s->length - s->position) : 0;
+    if (length > available) {
+        s->is_eof = true;
+        length    = available;
+    }
+
+    uint8_t *output_ptr = (uint8_t *)output_buf;
+    uint32_t done       = 0;
+    while (done < length) {
+        uint32_t               address = s->address + s->position;
+        qp_flash_cache_line_t *line    = flash_cache_find(s, address);
+        if (line == NULL) {
+            // Anything at least a line long goes straight to the output, the cache would only be overwritten
+            if (length - done >= QUANTUM_PAINTER_FLASH_CACHE_LINE_SIZE) {
+                if (!flash_read_range_shared(address, &output_ptr[done], length - done)) {
+                    break;
+                }
+                s->position += length - done;
+                done = length;
+                break;
+            }
+            line = flash_cache_fill(s, address);
+            if (line == NULL) {
+                break;
+            }
+        }
+
+        uint32_t offset = address - line->address;
+        uint32_t count  = line->length - offset < length - done ? line->length - offset : length - done;
+        memcpy(&output_ptr[done], &line->data[offset], count);
+        s->position += count;
+        done += count;
+    }
+    return done;
+}
+
+static inline int16_t flash_get(qp_stream_t *stream) {
+    uint8_t c;
+    if (flash_read(stream, &c, 1) != 1) {
+        return STREAM_EOF;
+    }
+    return c;
+}
+
+static inline bool flash_put(qp_stream_t *stream, uint8_t c) {
+    // Read-only, assets are written to flash ahead of time
+    return false;
+}
+
+static inline int flash_seek(qp_stream_t *stream, int32_t offset, int origin) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+
+    // Handle as per fseek, same as memory streams
+    int32_t position = s->position;
+    switch (origin) {
+        case SEEK_SET:
+            position = offset;
+            break;
+        case SEEK_CUR:
+            position += offset;
+            break;
+        case SEEK_END:
+            position = s->length + offset;
+            break;
+        default:
+            return -1;
+    }
+
+    if (position < 0 || position > s->length) {
+        return -1;
+    }
+
+    s->position = position;
+    s->is_eof   = false;
+    return 0;
+}
+
+static inline int32_t flash_tell(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->position;
+}
+
+static inline bool flash_is_eof(qp_stream_t *stream) {
+    qp_flash_stream_t *s = (qp_flash_stream_t *)stream;
+    return s->is_eof;
+}
+
+static inline void flash_close(qp_stream_t *stream) {
+    // No-op.
+}
+
+qp_flash_stream_t qp_make_flash_stream(uint32_t address, int32_t length) {
+    qp_flash_stream_t stream = {
+        .base     = {.get = flash_get, .read = flash_read, .put = flash_put, .seek = flash_seek, .tell = flash_tell, .is_eof = flash_is_eof, .close = flash_close},
+        .address  = address,
+        .length   = length,
+        .position = 0,
+    };
+    return stream;
+}
+
+void qp_flash_stream_invalidate(void) {
+    for (uint8_t i = 0; i < QUANTUM_PAINTER_FLASH_CACHE_LINES; ++i) {
+        flash_cache[i].length = 0;
+    }
+}
+
+#endif // FLASH_ENABLE
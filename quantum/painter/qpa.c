@@ -0,0 +1,115 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Quantum Painter Asset "QPA" directory format.
+// See https://docs.qmk.fm/#/quantum_painter_qpa for more information.
+
+#include <string.h>
+
+#include "qpa.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// QPA API
+
+bool qpa_read_directory_descriptor(qp_stream_t *stream, uint16_t *entry_count) {
+    // Seek to the start
+    qp_stream_setpos(stream, 0);
+
+    // Read and validate the directory descriptor
+    qpa_directory_descriptor_v1_t directory_descriptor;
+    if (qp_stream_read(&directory_descriptor, sizeof(qpa_directory_descriptor_v1_t), 1, stream) != 1) {
+        qp_dprintf("Failed to read directory_descriptor, expected length was not %d\n", (int)sizeof(qpa_directory_descriptor_v1_t));
+        return false;
+    }
+
+    // Make sure this block is valid
+    if (!qgf_validate_block_header(&directory_descriptor.header, QPA_DIRECTORY_DESCRIPTOR_TYPEID, (sizeof(qpa_directory_descriptor_v1_t) - sizeof(qgf_block_header_v1_t)))) {
+        return false;
+    }
+
+    // Make sure the magic and version are correct
+    if (directory_descriptor.magic != QPA_MAGIC || directory_descriptor.qpa_version != 0x01) {
+        qp_dprintf("Failed to validate directory_descriptor, expected magic 0x%06X was 0x%06X, expected version = 0x%02X was 0x%02X\n", (int)QPA_MAGIC, (int)directory_descriptor.magic, (int)0x01, (int)directory_descriptor.qpa_version);
+        return false;
+    }
+
+    // Make sure the entry table follows
+    qpa_entry_table_v1_t entry_table;
+    if (qp_stream_read(&entry_table, sizeof(qpa_entry_table_v1_t), 1, stream) != 1) {
+        qp_dprintf("Failed to read entry_table, expected length was not %d\n", (int)sizeof(qpa_entry_table_v1_t));
+        return false;
+    }
+    if (!qgf_validate_block_header(&entry_table.header, QPA_ENTRY_TABLE_TYPEID, directory_descriptor.entry_count * sizeof(qpa_entry_v1_t))) {
+        return false;
+    }
+
+    if (entry_count) {
+        *entry_count = directory_descriptor.entry_count;
+    }
+    return true;
+}
+
+bool qpa_find_asset(qp_stream_t *stream, const char *name, uint32_t *offset, uint32_t *length) {
+    // Names are stored padded with NUL, so compare against the name padded the same way
+    char key[QPA_NAME_LENGTH] = {0};
+    if (strlen(name) > QPA_NAME_LENGTH) {
+        return false;
+    }
+    memcpy(key, name, strlen(name));
+
+    uint16_t entry_count;
+    if (!qpa_read_directory_descriptor(stream, &entry_count)) {
+        return false;
+    }
+
+    // Entries are sorted, so binary search -- each probe is a separate read when the directory is in flash
+    const uint32_t first = sizeof(qpa_directory_descriptor_v1_t) + sizeof(qpa_entry_table_v1_t);
+    uint16_t       lo    = 0;
+    uint16_t       hi    = entry_count;
+    while (lo < hi) {
+        uint16_t       mid = lo + (hi - lo) / 2;
+        qpa_entry_v1_t entry;
+        qp_stream_setpos(stream, first + mid * sizeof(qpa_entry_v1_t));
+        if (qp_stream_read(&entry, sizeof(qpa_entry_v1_t), 1, stream) != 1) {
+            return false;
+        }
+
+        int cmp = memcmp(key, entry.name, QPA_NAME_LENGTH);
+        if (cmp == 0) {
+            if (offset) {
+                *offset = entry.offset;
+            }
+            if (length) {
+                *length = entry.length;
+            }
+            return true;
+        }
+        if (cmp < 0) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+
+    qp_dprintf("qpa_find_asset: could not find '%s'\n", name);
+    return false;
+}
+
+#ifdef FLASH_ENABLE
+bool qpa_find_flash_asset(const char *name, uint32_t *address) {
+    // Assume we can read the directory descriptor, then extend the stream to cover the entries
+    qp_flash_stream_t stream = qp_make_flash_stream(QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS, sizeof(qpa_directory_descriptor_v1_t) + sizeof(qpa_entry_table_v1_t));
+    uint16_t          entry_count;
+    if (!qpa_read_directory_descriptor(&stream.base, &entry_count)) {
+        return false;
+    }
+    stream.length += entry_count * sizeof(qpa_entry_v1_t);
+
+    uint32_t offset;
+    if (!qpa_find_asset(&stream.base, name, &offset, NULL)) {
+        return false;
+    }
+    *address = QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS + offset;
+    return true;
+}
+#endif // FLASH_ENABLE
@@ -0,0 +1,67 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+// Quantum Painter Asset "QPA" directory format.
+// See https://docs.qmk.fm/#/quantum_painter_qpa for more information.
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "compiler_support.h"
+#include "qp_stream.h"
+#include "qp_internal.h"
+#include "qgf.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// QPA structures
+
+/////////////////////////////////////////
+// Directory descriptor
+
+#define QPA_DIRECTORY_DESCRIPTOR_TYPEID 0x00
+
+typedef struct PACKED qpa_directory_descriptor_v1_t {
+    qgf_block_header_v1_t header;      // = { .type_id = 0x00, .neg_type_id = (~0x00), .length = 6 }
+    uint32_t              magic : 24;  // constant, equal to 0x415051 ("QPA")
+    uint8_t               qpa_version; // constant, equal to 0x01
+    uint16_t              entry_count; // number of entries in the entry table
+} qpa_directory_descriptor_v1_t;
+
+STATIC_ASSERT(sizeof(qpa_directory_descriptor_v1_t) == (sizeof(qgf_block_header_v1_t) + 6), "qpa_directory_descriptor_v1_t must be 11 bytes in v1 of QPA");
+
+#define QPA_MAGIC 0x415051
+
+/////////////////////////////////////////
+// Entry table
+
+#define QPA_ENTRY_TABLE_TYPEID 0x01
+
+#define QPA_NAME_LENGTH 24
+
+typedef struct PACKED qpa_entry_v1_t {
+    char     name[QPA_NAME_LENGTH]; // padded with NUL, only terminated if shorter than QPA_NAME_LENGTH
+    uint32_t offset;                // location of the asset, relative to the start of the directory
+    uint32_t length;                // size of the asset in bytes
+} qpa_entry_v1_t;
+
+STATIC_ASSERT(sizeof(qpa_entry_v1_t) == 32, "qpa_entry_v1_t must be 32 bytes in v1 of QPA");
+
+typedef struct PACKED qpa_entry_table_v1_t {
+    qgf_block_header_v1_t header;   // = { .type_id = 0x01, .neg_type_id = (~0x01), .length = (N * sizeof(qpa_entry_v1_t)) }
+    qpa_entry_v1_t        entry[0]; // entries sorted by name, compared byte by byte
+} qpa_entry_table_v1_t;
+
+STATIC_ASSERT(sizeof(qpa_entry_table_v1_t) == sizeof(qgf_block_header_v1_t), "qpa_entry_table_v1_t must only contain qgf_block_header_v1_t in v1 of QPA");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// QPA API
+
+bool qpa_read_directory_descriptor(qp_stream_t *stream, uint16_t *entry_count);
+bool qpa_find_asset(qp_stream_t *stream, const char *name, uint32_t *offset, uint32_t *length);
+
+#ifdef FLASH_ENABLE
+// Looks up an asset in the directory at QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS, giving its location in flash
+bool qpa_find_flash_asset(const char *name, uint32_t *address);
+#endif // FLASH_ENABLE
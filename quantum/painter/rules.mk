@@ -36,6 +36,7 @@ SRC += \
     $(QUANTUM_DIR)/painter/qp_stream.c \
     $(QUANTUM_DIR)/painter/qgf.c \
     $(QUANTUM_DIR)/painter/qff.c \
+    $(QUANTUM_DIR)/painter/qpa.c \
     $(QUANTUM_DIR)/painter/qp_draw_core.c \
     $(QUANTUM_DIR)/painter/qp_draw_codec.c \
     $(QUANTUM_DIR)/painter/qp_draw_circle.c \
@@ -247,6 +248,7 @@ ifeq ($(strip $(QUANTUM_PAINTER_NEEDS_SURFACE)), yes)
     SRC += \
         $(DRIVER_PATH)/painter/generic/qp_surface_common.c \
         $(DRIVER_PATH)/painter/generic/qp_surface_mono1bpp.c \
+        $(DRIVER_PATH)/painter/generic/qp_surface_palette.c \
         $(DRIVER_PATH)/painter/generic/qp_surface_rgb565.c \
         $(DRIVER_PATH)/painter/generic/qp_surface_rgb888.c
 endif
@@ -39,6 +39,28 @@
 #    endif
 #endif
 
+#ifdef POINTING_DEVICE_MOTION_INTERRUPT
+#    include "pointing_device_motion.h"
+// the motion thread uses the driver concurrently
+#    define POINTING_DEVICE_DRIVER_LOCK() pointing_device_motion_lock()
+#    define POINTING_DEVICE_DRIVER_UNLOCK() pointing_device_motion_unlock()
+#    ifndef POINTING_DEVICE_TASK_THROTTLE_MS
+// sensor reads are decoupled from the main loop, send at the USB polling rate
+#        ifdef USB_POLLING_INTERVAL_MS
+#            define POINTING_DEVICE_TASK_THROTTLE_MS USB_POLLING_INTERVAL_MS
+#        else
+#            define POINTING_DEVICE_TASK_THROTTLE_MS 1
+#        endif
+#    endif
+#else
+#    define POINTING_DEVICE_DRIVER_LOCK()
+#    define POINTING_DEVICE_DRIVER_UNLOCK()
+#endif
+
+#ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+#    include "pointing_device_transform.h"
+#endif
+
 #if defined(SPLIT_POINTING_ENABLE)
 #    include "transactions.h"
 #    include "keyboard.h"
@@ -46,15 +68,118 @@
 report_mouse_t shared_mouse_report = {};
 uint16_t       shared_cpi          = 0;
 
+/* Motion of each side that hasn't been sent yet. Without a common cpi these
+ * are plain counts, otherwise counts multiplied by the side's cpi. */
+typedef struct {
+    int32_t x;
+    int32_t y;
+    int32_t h;
+    int32_t v;
+} pointing_device_residual_t;
+
+static pointing_device_residual_t      shared_residual;
+static uint8_t                         shared_buttons;
+static pointing_device_shared_motion_t last_shared_motion;
+static bool                            last_shared_motion_valid = false;
+
+static void pointing_device_add_motion(pointing_device_residual_t *residual, int32_t x, int32_t y, int32_t h, int32_t v) {
+#    ifdef POINTING_DEVICE_COMBINED_CPI
+    x *= POINTING_DEVICE_COMBINED_CPI;
+    y *= POINTING_DEVICE_COMBINED_CPI;
+#    endif
+    residual->x += x;
+    residual->y += y;
+    residual->h += h;
+    residual->v += v;
+}
+
+static inline int32_t pointing_device_take(int32_t *residual, uint16_t cpi, int32_t min, int32_t max) {
+#    ifdef POINTING_DEVICE_COMBINED_CPI
+    int32_t divisor = cpi ? cpi : POINTING_DEVICE_COMBINED_CPI;
+#    else
+    const int32_t divisor = 1;
+#    endif
+    // Like the carry of pointing_device_combine_reports(), only keep up to two
+    // reports worth of motion, so the cursor stops soon after the sensor does
+    int64_t limit = 2 * ((int64_t)max + 1) * divisor;
+    *residual     = *residual < -limit ? -limit : (*residual > limit ? limit : *residual);
+
+    int32_t value = *residual / divisor;
+    value         = value < min ? min : (value > max ? max : value);
+    *residual -= value * divisor;
+    return value;
+}
+
 /**
- * @brief Sets the shared mouse report used be pointing device task
+ * @brief Takes as much of a side's motion as fits into a report, the rest is kept for the next one
+ *
+ * @param[in] residual motion not sent yet
+ * @param[in] cpi cpi of the side's sensor, used to scale it to POINTING_DEVICE_COMBINED_CPI
+ * @param[in] mouse_report report to fill in
+ * @return report_mouse_t with the motion taken
+ */
+static report_mouse_t pointing_device_take_motion(pointing_device_residual_t *residual, uint16_t cpi, report_mouse_t mouse_report) {
+    mouse_report.x = pointing_device_take(&residual->x, cpi, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    mouse_report.y = pointing_device_take(&residual->y, cpi, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    mouse_report.h = pointing_device_take(&residual->h, 1, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+    mouse_report.v = pointing_device_take(&residual->v, 1, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+    return mouse_report;
+}
+
+/**
+ * @brief Adds the motion of a report to the shared motion used by pointing device task
+ *
+ * The motion is added to what hasn't been sent yet rather than replacing it,
+ * so calling this more than once per task no longer drops the earlier reports.
  *
  * NOTE : Only available when using SPLIT_POINTING_ENABLE
  *
  * @param[in] new_mouse_report report_mouse_t
  */
 void pointing_device_set_shared_report(report_mouse_t new_mouse_report) {
-    shared_mouse_report = new_mouse_report;
+    pointing_device_add_motion(&shared_residual, new_mouse_report.x, new_mouse_report.y, new_mouse_report.h, new_mouse_report.v);
+    shared_buttons = new_mouse_report.buttons;
+}
+
+/**
+ * @brief Adds the motion the other half read since the last call to the shared motion
+ *
+ * The other half keeps adding up its sensor reads between transactions, so
+ * none of them are lost when the transport is slower than the sensor.
+ *
+ * NOTE : Only available when using SPLIT_POINTING_ENABLE
+ *
+ * @param[in] motion running totals of the other half
+ */
+void pointing_device_set_shared_motion(const pointing_device_shared_motion_t *motion) {
+    if (last_shared_motion_valid) {
+        pointing_device_add_motion(&shared_residual, (int16_t)(motion->x - last_shared_motion.x), (int16_t)(motion->y - last_shared_motion.y), (int16_t)(motion->h - last_shared_motion.h), (int16_t)(motion->v - last_shared_motion.v));
+    }
+    shared_buttons           = motion->buttons;
+    last_shared_motion       = *motion;
+    last_shared_motion_valid = true;
+}
+
+/**
+ * @brief Forgets the running totals of the other half and its unsent motion
+ *
+ * The other half starts its totals from zero again after a restart, so the
+ * next totals only serve as the new reference. Called when the link drops.
+ *
+ * NOTE : Only available when using SPLIT_POINTING_ENABLE
+ */
+void pointing_device_reset_shared_motion(void) {
+    last_shared_motion_valid = false;
+    shared_residual          = (pointing_device_residual_t){0};
+}
+
+/**
+ * @brief Takes the shared motion into a report
+ *
+ * @return report_mouse_t of the other half
+ */
+static report_mouse_t pointing_device_get_shared_report(void) {
+    return pointing_device_take_motion(&shared_residual, last_shared_motion.cpi, (report_mouse_t){.buttons = shared_buttons});
 }
 
 /**
@@ -194,6 +319,11 @@ __attribute__((weak)) void pointing_device_init(void) {
 #    else
         gpio_set_pin_input(POINTING_DEVICE_MOTION_PIN);
 #    endif
+#endif
+#ifdef POINTING_DEVICE_MOTION_INTERRUPT
+        if (pointing_device_status == POINTING_DEVICE_STATUS_SUCCESS) {
+            pointing_device_motion_init();
+        }
 #endif
     }
 #ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
@@ -202,6 +332,9 @@ __attribute__((weak)) void pointing_device_init(void) {
         hires_scroll_resolution *= 10;
     }
 #endif
+#ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+    pointing_device_transform_init();
+#endif
 
     pointing_device_init_modules();
     pointing_device_init_kb();
@@ -316,36 +449,48 @@ __attribute__((weak)) bool pointing_device_task(void) {
     }
 
     // Gather report info
-#ifdef POINTING_DEVICE_MOTION_PIN
-#    if defined(SPLIT_POINTING_ENABLE)
-#        error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides.
-#    endif
-#    ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+#if defined(POINTING_DEVICE_MOTION_INTERRUPT)
+    // the sensor is read by the motion thread, only collect what it has read
+    local_mouse_report = pointing_device_motion_get_report(local_mouse_report);
+#else
+#    ifdef POINTING_DEVICE_MOTION_PIN
+#        if defined(SPLIT_POINTING_ENABLE)
+#            error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides.
+#        endif
+#        ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
     if (!gpio_read_pin(POINTING_DEVICE_MOTION_PIN))
-#    else
+#        else
     if (gpio_read_pin(POINTING_DEVICE_MOTION_PIN))
-#    endif
+#        endif
     {
-#endif
+#    endif
 
-#if defined(SPLIT_POINTING_ENABLE)
-#    if defined(POINTING_DEVICE_COMBINED)
+#    if defined(SPLIT_POINTING_ENABLE)
+#        if defined(POINTING_DEVICE_COMBINED)
         static uint8_t old_buttons = 0;
         local_mouse_report.buttons = old_buttons;
         local_mouse_report         = pointing_device_driver->get_report(local_mouse_report);
         old_buttons                = local_mouse_report.buttons;
-#    elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
-        local_mouse_report = POINTING_DEVICE_THIS_SIDE ? pointing_device_driver->get_report(local_mouse_report) : shared_mouse_report;
+#            ifdef POINTING_DEVICE_COMBINED_CPI
+        // bring the local sensor to the common cpi as well
+        static pointing_device_residual_t local_residual;
+        pointing_device_add_motion(&local_residual, local_mouse_report.x, local_mouse_report.y, local_mouse_report.h, local_mouse_report.v);
+        local_mouse_report = pointing_device_take_motion(&local_residual, pointing_device_driver->get_cpi ? pointing_device_driver->get_cpi() : 0, local_mouse_report);
+#            endif
+        shared_mouse_report = pointing_device_get_shared_report();
+#        elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
+        local_mouse_report = POINTING_DEVICE_THIS_SIDE ? pointing_device_driver->get_report(local_mouse_report) : pointing_device_get_shared_report();
+#        else
+#            error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
+#        endif
 #    else
-#        error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
-#    endif
-#else
     local_mouse_report = pointing_device_driver->get_report(local_mouse_report);
-#endif // defined(SPLIT_POINTING_ENABLE)
+#    endif // defined(SPLIT_POINTING_ENABLE)
 
-#ifdef POINTING_DEVICE_MOTION_PIN
+#    ifdef POINTING_DEVICE_MOTION_PIN
     }
-#endif
+#    endif
+#endif // POINTING_DEVICE_MOTION_INTERRUPT
 
     // allow kb to intercept and modify report
 #if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
@@ -359,6 +504,9 @@ __attribute__((weak)) bool pointing_device_task(void) {
     local_mouse_report = is_keyboard_left() ? pointing_device_task_combined_kb(local_mouse_report, shared_mouse_report) : pointing_device_task_combined_kb(shared_mouse_report, local_mouse_report);
 #else
     local_mouse_report = pointing_device_adjust_by_defines(local_mouse_report);
+#endif
+#ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+    local_mouse_report = pointing_device_transform(local_mouse_report);
 #endif
     local_mouse_report = pointing_device_task_modules(local_mouse_report);
     local_mouse_report = pointing_device_task_kb(local_mouse_report);
@@ -408,7 +556,10 @@ uint16_t pointing_device_get_cpi(void) {
 #if defined(SPLIT_POINTING_ENABLE)
     return POINTING_DEVICE_THIS_SIDE ? pointing_device_driver->get_cpi() : shared_cpi;
 #else
-    return pointing_device_driver->get_cpi();
+    POINTING_DEVICE_DRIVER_LOCK();
+    uint16_t cpi = pointing_device_driver->get_cpi();
+    POINTING_DEVICE_DRIVER_UNLOCK();
+    return cpi;
 #endif
 }
 
@@ -427,7 +578,9 @@ void pointing_device_set_cpi(uint16_t cpi) {
         shared_cpi = cpi;
     }
 #else
+    POINTING_DEVICE_DRIVER_LOCK();
     pointing_device_driver->set_cpi(cpi);
+    POINTING_DEVICE_DRIVER_UNLOCK();
 #endif
 }
 
@@ -485,7 +638,8 @@ static inline mouse_xy_report_t pointing_device_xy_clamp(xy_clamp_range_t value)
 /**
  * @brief combines 2 mouse reports and returns 2
  *
- * Combines 2 report_mouse_t structs, clamping movement values to int8_t and ignores report_id then returns the resulting report_mouse_t struct.
+ * Combines 2 report_mouse_t structs, clamping movement values to the report range and ignores report_id then returns the resulting report_mouse_t struct.
+ * Motion that doesn't fit is carried over to the next call, up to another full report.
  *
  * NOTE: Only available when using SPLIT_POINTING_ENABLE and POINTING_DEVICE_COMBINED
  *
@@ -494,10 +648,21 @@ static inline mouse_xy_report_t pointing_device_xy_clamp(xy_clamp_range_t value)
  * @return combined report_mouse_t of left_report and right_report
  */
 report_mouse_t pointing_device_combine_reports(report_mouse_t left_report, report_mouse_t right_report) {
-    left_report.x = pointing_device_xy_clamp((xy_clamp_range_t)left_report.x + right_report.x);
-    left_report.y = pointing_device_xy_clamp((xy_clamp_range_t)left_report.y + right_report.y);
-    left_report.h = pointing_device_hv_clamp((hv_clamp_range_t)left_report.h + right_report.h);
-    left_report.v = pointing_device_hv_clamp((hv_clamp_range_t)left_report.v + right_report.v);
+    static xy_clamp_range_t carry_x = 0, carry_y = 0;
+    static hv_clamp_range_t carry_h = 0, carry_v = 0;
+
+    xy_clamp_range_t x = carry_x + left_report.x + right_report.x;
+    xy_clamp_range_t y = carry_y + left_report.y + right_report.y;
+    hv_clamp_range_t h = carry_h + left_report.h + right_report.h;
+    hv_clamp_range_t v = carry_v + left_report.v + right_report.v;
+    left_report.x      = pointing_device_xy_clamp(x);
+    left_report.y      = pointing_device_xy_clamp(y);
+    left_report.h      = pointing_device_hv_clamp(h);
+    left_report.v      = pointing_device_hv_clamp(v);
+    carry_x            = pointing_device_xy_clamp(x - left_report.x);
+    carry_y            = pointing_device_xy_clamp(y - left_report.y);
+    carry_h            = pointing_device_hv_clamp(h - left_report.h);
+    carry_v            = pointing_device_hv_clamp(v - left_report.v);
     left_report.buttons |= right_report.buttons;
     return left_report;
 }
@@ -141,7 +141,19 @@ uint16_t pointing_device_get_hires_scroll_resolution(void);
 #endif
 
 #if defined(SPLIT_POINTING_ENABLE)
+/* Motion read by the other half, as running totals that wrap around */
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t h;
+    uint16_t v;
+    uint8_t  buttons;
+    uint16_t cpi;
+} PACKED pointing_device_shared_motion_t;
+
 void     pointing_device_set_shared_report(report_mouse_t report);
+void     pointing_device_set_shared_motion(const pointing_device_shared_motion_t *motion);
+void     pointing_device_reset_shared_motion(void);
 uint16_t pointing_device_get_shared_cpi(void);
 #    if !defined(POINTING_DEVICE_TASK_THROTTLE_MS)
 #        define POINTING_DEVICE_TASK_THROTTLE_MS 1
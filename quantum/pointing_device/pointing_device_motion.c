@@ -0,0 +1,150 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef POINTING_DEVICE_MOTION_INTERRUPT
+
+#    include <ch.h>
+#    include <hal.h>
+
+#    include "pointing_device.h"
+#    include "pointing_device_motion.h"
+#    include "gpio.h"
+
+#    if !defined(POINTING_DEVICE_MOTION_PIN)
+#        error "POINTING_DEVICE_MOTION_INTERRUPT requires POINTING_DEVICE_MOTION_PIN"
+#    endif
+
+#    if defined(SPLIT_POINTING_ENABLE)
+#        error "POINTING_DEVICE_MOTION_INTERRUPT is not supported when sharing the pointing device report between sides."
+#    endif
+
+/* I2C transfers aren't serialized between threads, and bit-banged or analog
+ * sensors spin while they are read, so only SPI sensors that sleep through
+ * their delays may be read from the motion thread. */
+#    if !(defined(POINTING_DEVICE_DRIVER_pmw3360) || defined(POINTING_DEVICE_DRIVER_pmw3389) || defined(POINTING_DEVICE_DRIVER_adns9800) || defined(POINTING_DEVICE_DRIVER_paw3222) || defined(POINTING_DEVICE_DRIVER_custom))
+#        error "POINTING_DEVICE_MOTION_INTERRUPT is only supported with the pmw3360, pmw3389, adns9800 and paw3222 drivers, or a custom driver."
+#    endif
+
+#    if (PAL_USE_WAIT == FALSE)
+#        error "POINTING_DEVICE_MOTION_INTERRUPT requires PAL_USE_WAIT"
+#    endif
+
+extern const pointing_device_driver_t *pointing_device_driver;
+
+/* Serializes driver calls between the motion thread and the main loop, the
+ * bus mutex alone doesn't protect the driver's own state. */
+static MUTEX_DECL(driver_mutex);
+
+/* Samples read by the motion thread, drained by the main loop. */
+static report_mouse_t samples[POINTING_DEVICE_MOTION_BUFFER_SIZE];
+static uint8_t        samples_head;
+static uint8_t        samples_count;
+
+/* Motion that didn't fit into the last report. */
+static int32_t residual_x, residual_y, residual_h, residual_v;
+/* Buttons reported by the sensor, kept apart from the ones set by keycodes. */
+static uint8_t sensor_buttons, applied_buttons;
+
+static inline int32_t clamp(int32_t value, int32_t min, int32_t max) {
+    return value < min ? min : (value > max ? max : value);
+}
+
+static inline bool motion_active(void) {
+#    ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+    return !gpio_read_pin(POINTING_DEVICE_MOTION_PIN);
+#    else
+    return gpio_read_pin(POINTING_DEVICE_MOTION_PIN);
+#    endif
+}
+
+static void samples_push(report_mouse_t sample) {
+    chSysLock();
+    if (samples_count < POINTING_DEVICE_MOTION_BUFFER_SIZE) {
+        samples[(samples_head + samples_count) % POINTING_DEVICE_MOTION_BUFFER_SIZE] = sample;
+        samples_count++;
+    } else {
+        /* The main loop is behind, merge into the newest sample so no motion is lost. */
+        report_mouse_t *newest = &samples[(samples_head + samples_count - 1) % POINTING_DEVICE_MOTION_BUFFER_SIZE];
+        newest->x              = clamp(newest->x + sample.x, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+        newest->y              = clamp(newest->y + sample.y, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+        newest->h              = clamp(newest->h + sample.h, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+        newest->v              = clamp(newest->v + sample.v, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+        newest->buttons        = sample.buttons;
+    }
+    chSysUnlock();
+}
+
+/* Reads the sensor while the motion pin is active. The burst read sleeps
+ * while the SPI transfers complete and through the sensor's delays, so the
+ * main loop keeps scanning in the meantime. */
+static THD_WORKING_AREA(waMotionThread, POINTING_DEVICE_MOTION_THREAD_STACK_SIZE);
+static THD_FUNCTION(MotionThread, arg) {
+    (void)arg;
+    chRegSetThreadName("pointing_device_motion");
+
+    report_mouse_t sample = {0};
+    while (true) {
+        /* Also wakes up periodically, in case an edge was missed while reading. */
+        if (!motion_active()) {
+            palWaitLineTimeout(POINTING_DEVICE_MOTION_PIN, TIME_MS2I(POINTING_DEVICE_MOTION_TIMEOUT_MS));
+            if (!motion_active()) {
+                continue;
+            }
+        }
+
+        pointing_device_motion_lock();
+        sample = pointing_device_driver->get_report((report_mouse_t){.buttons = sample.buttons});
+        pointing_device_motion_unlock();
+        samples_push(sample);
+
+        chThdSleepMicroseconds(POINTING_DEVICE_MOTION_INTERVAL_US);
+    }
+}
+
+void pointing_device_motion_lock(void) {
+    chMtxLock(&driver_mutex);
+}
+
+void pointing_device_motion_unlock(void) {
+    chMtxUnlock(&driver_mutex);
+}
+
+void pointing_device_motion_init(void) {
+#    ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+    palEnableLineEvent(POINTING_DEVICE_MOTION_PIN, PAL_EVENT_MODE_FALLING_EDGE);
+#    else
+    palEnableLineEvent(POINTING_DEVICE_MOTION_PIN, PAL_EVENT_MODE_RISING_EDGE);
+#    endif
+    chThdCreateStatic(waMotionThread, sizeof(waMotionThread), HIGHPRIO, MotionThread, NULL);
+}
+
+static inline int32_t take(int32_t *residual, int32_t min, int32_t max) {
+    int32_t value = clamp(*residual, min, max);
+    *residual -= value;
+    return value;
+}
+
+report_mouse_t pointing_device_motion_get_report(report_mouse_t mouse_report) {
+    chSysLock();
+    for (; samples_count > 0; samples_count--) {
+        report_mouse_t *sample = &samples[samples_head];
+        residual_x += sample->x;
+        residual_y += sample->y;
+        residual_h += sample->h;
+        residual_v += sample->v;
+        sensor_buttons = sample->buttons;
+        samples_head   = (samples_head + 1) % POINTING_DEVICE_MOTION_BUFFER_SIZE;
+    }
+    chSysUnlock();
+
+    mouse_report.x       = take(&residual_x, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    mouse_report.y       = take(&residual_y, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    mouse_report.h       = take(&residual_h, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+    mouse_report.v       = take(&residual_v, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+    mouse_report.buttons = (mouse_report.buttons & ~applied_buttons) | sensor_buttons;
+    applied_buttons      = sensor_buttons;
+
+    return mouse_report;
+}
+
+#endif // POINTING_DEVICE_MOTION_INTERRUPT
@@ -0,0 +1,46 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "report.h"
+
+#ifndef POINTING_DEVICE_MOTION_BUFFER_SIZE
+#    define POINTING_DEVICE_MOTION_BUFFER_SIZE 8
+#endif
+
+#ifndef POINTING_DEVICE_MOTION_INTERVAL_US
+#    define POINTING_DEVICE_MOTION_INTERVAL_US 250
+#endif
+
+#ifndef POINTING_DEVICE_MOTION_TIMEOUT_MS
+#    define POINTING_DEVICE_MOTION_TIMEOUT_MS 10
+#endif
+
+#ifndef POINTING_DEVICE_MOTION_THREAD_STACK_SIZE
+#    define POINTING_DEVICE_MOTION_THREAD_STACK_SIZE 256
+#endif
+
+/**
+ * @brief Start reading the sensor from its own thread whenever the motion pin
+ * becomes active.
+ */
+void pointing_device_motion_init(void);
+
+/**
+ * @brief Take exclusive use of the sensor driver. The motion thread holds it
+ * while reading, so calls into the driver from other threads, e.g. setting
+ * the cpi, have to be wrapped in a lock/unlock pair.
+ */
+void pointing_device_motion_lock(void);
+void pointing_device_motion_unlock(void);
+
+/**
+ * @brief Sum up the motion read since the last call into `mouse_report`.
+ *
+ * Motion that doesn't fit into the report is kept for the next call. The
+ * buttons are taken from the latest sensor read.
+ */
+report_mouse_t pointing_device_motion_get_report(report_mouse_t mouse_report);
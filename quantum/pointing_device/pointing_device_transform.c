@@ -0,0 +1,192 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#ifdef POINTING_DEVICE_TRANSFORM_ENABLE
+
+#    include "pointing_device_transform.h"
+#    include "pointing_device.h"
+#    include "eeconfig.h"
+
+static const pointing_device_curve_point_t acceleration_curve[] = POINTING_DEVICE_ACCELERATION_CURVE;
+
+STATIC_ASSERT(ARRAY_SIZE(acceleration_curve) > 0, "POINTING_DEVICE_ACCELERATION_CURVE needs at least one point");
+
+static pointing_device_config_t config;
+static bool                     drag_scroll;
+/* Gain from sensor counts to wheel units while drag scrolling */
+static int32_t scroll_gain;
+
+/* Motion not sent yet, with 8 fractional bits */
+static int32_t residual_x, residual_y, residual_h, residual_v;
+
+static void clear_residuals(void) {
+    residual_x = residual_y = residual_h = residual_v = 0;
+}
+
+static void update_scroll_gain(void) {
+#    ifdef POINTING_DEVICE_HIRES_SCROLL_ENABLE
+    int32_t resolution = pointing_device_get_hires_scroll_resolution();
+#    else
+    int32_t resolution = 1;
+#    endif
+    scroll_gain = resolution * POINTING_DEVICE_TRANSFORM_ONE / config.scroll_divisor;
+}
+
+void eeconfig_update_pointing_device_default(void) {
+    config = (pointing_device_config_t){
+        .sensitivity    = POINTING_DEVICE_SENSITIVITY_DEFAULT,
+        .acceleration   = POINTING_DEVICE_ACCELERATION_DEFAULT,
+        .scroll_divisor = POINTING_DEVICE_SCROLL_DIVISOR_DEFAULT,
+    };
+    eeconfig_update_pointing_device(&config);
+}
+
+void pointing_device_transform_init(void) {
+    eeconfig_read_pointing_device(&config);
+    if (config.sensitivity == 0 || config.scroll_divisor == 0) {
+        eeconfig_update_pointing_device_default();
+    }
+    update_scroll_gain();
+    clear_residuals();
+}
+
+uint16_t pointing_device_get_acceleration_gain(uint16_t speed) {
+    if (config.acceleration == 0) {
+        return POINTING_DEVICE_TRANSFORM_ONE;
+    }
+
+    const uint8_t count = ARRAY_SIZE(acceleration_curve);
+    int32_t       gain  = acceleration_curve[count - 1].gain;
+    if (speed <= acceleration_curve[0].speed) {
+        gain = acceleration_curve[0].gain;
+    } else {
+        for (uint8_t i = 1; i < count; i++) {
+            const pointing_device_curve_point_t *low  = &acceleration_curve[i - 1];
+            const pointing_device_curve_point_t *high = &acceleration_curve[i];
+            if (speed < high->speed) {
+                gain = low->gain + ((int32_t)high->gain - low->gain) * (speed - low->speed) / (high->speed - low->speed);
+                break;
+            }
+        }
+    }
+
+    return POINTING_DEVICE_TRANSFORM_ONE + (gain - POINTING_DEVICE_TRANSFORM_ONE) * config.acceleration / UINT8_MAX;
+}
+
+/* Adds `delta` scaled by `gain` to the residual and takes as much of it as
+ * fits into the report. What doesn't fit is kept for the next report, but no
+ * more than another full report so a fast flick doesn't drag on. */
+static int32_t accumulate(int32_t *residual, int32_t delta, int32_t gain, int32_t min, int32_t max) {
+    int64_t value = *residual + (int64_t)delta * gain;
+    int64_t limit = 2 * ((int64_t)max + 1) * POINTING_DEVICE_TRANSFORM_ONE;
+    value         = value < -limit ? -limit : (value > limit ? limit : value);
+
+    int32_t out = (int32_t)(value / POINTING_DEVICE_TRANSFORM_ONE);
+    out         = out < min ? min : (out > max ? max : out);
+    *residual   = (int32_t)(value - (int64_t)out * POINTING_DEVICE_TRANSFORM_ONE);
+    return out;
+}
+
+report_mouse_t pointing_device_transform(report_mouse_t mouse_report) {
+    int32_t x = mouse_report.x;
+    int32_t y = mouse_report.y;
+
+    if (drag_scroll) {
+        mouse_report.x = 0;
+        mouse_report.y = 0;
+        mouse_report.h = accumulate(&residual_h, x, scroll_gain, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+        mouse_report.v = accumulate(&residual_v, y, scroll_gain, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+        return mouse_report;
+    }
+
+    // cheap approximation of the length of the movement
+    uint32_t ax    = x < 0 ? -x : x;
+    uint32_t ay    = y < 0 ? -y : y;
+    uint32_t speed = ax > ay ? ax + ay / 2 : ay + ax / 2;
+    if (speed > UINT16_MAX) {
+        speed = UINT16_MAX;
+    }
+    int32_t gain = (int32_t)pointing_device_get_acceleration_gain(speed) * config.sensitivity / 16;
+
+    mouse_report.x = accumulate(&residual_x, x, gain, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    mouse_report.y = accumulate(&residual_y, y, gain, MOUSE_REPORT_XY_MIN, MOUSE_REPORT_XY_MAX);
+    mouse_report.h = accumulate(&residual_h, mouse_report.h, POINTING_DEVICE_TRANSFORM_ONE, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+    mouse_report.v = accumulate(&residual_v, mouse_report.v, POINTING_DEVICE_TRANSFORM_ONE, MOUSE_REPORT_HV_MIN, MOUSE_REPORT_HV_MAX);
+    return mouse_report;
+}
+
+pointing_device_config_t pointing_device_get_config(void) {
+    return config;
+}
+
+void pointing_device_set_config_noeeprom(pointing_device_config_t new_config) {
+    if (new_config.sensitivity == 0) {
+        new_config.sensitivity = 1;
+    }
+    if (new_config.scroll_divisor == 0) {
+        new_config.scroll_divisor = 1;
+    }
+    config = new_config;
+    update_scroll_gain();
+}
+
+void pointing_device_set_config(pointing_device_config_t new_config) {
+    pointing_device_set_config_noeeprom(new_config);
+    eeconfig_update_pointing_device(&config);
+}
+
+uint8_t pointing_device_get_sensitivity(void) {
+    return config.sensitivity;
+}
+
+void pointing_device_set_sensitivity_noeeprom(uint8_t sensitivity) {
+    pointing_device_config_t new_config = config;
+    new_config.sensitivity              = sensitivity;
+    pointing_device_set_config_noeeprom(new_config);
+}
+
+void pointing_device_set_sensitivity(uint8_t sensitivity) {
+    pointing_device_set_sensitivity_noeeprom(sensitivity);
+    eeconfig_update_pointing_device(&config);
+}
+
+uint8_t pointing_device_get_acceleration(void) {
+    return config.acceleration;
+}
+
+void pointing_device_set_acceleration_noeeprom(uint8_t acceleration) {
+    config.acceleration = acceleration;
+}
+
+void pointing_device_set_acceleration(uint8_t acceleration) {
+    pointing_device_set_acceleration_noeeprom(acceleration);
+    eeconfig_update_pointing_device(&config);
+}
+
+uint8_t pointing_device_get_scroll_divisor(void) {
+    return config.scroll_divisor;
+}
+
+void pointing_device_set_scroll_divisor_noeeprom(uint8_t divisor) {
+    pointing_device_config_t new_config = config;
+    new_config.scroll_divisor           = divisor;
+    pointing_device_set_config_noeeprom(new_config);
+}
+
+void pointing_device_set_scroll_divisor(uint8_t divisor) {
+    pointing_device_set_scroll_divisor_noeeprom(divisor);
+    eeconfig_update_pointing_device(&config);
+}
+
+bool pointing_device_get_drag_scroll(void) {
+    return drag_scroll;
+}
+
+void pointing_device_set_drag_scroll(bool enable) {
+    if (drag_scroll != enable) {
+        drag_scroll = enable;
+        clear_residuals();
+    }
+}
+
+#endif // POINTING_DEVICE_TRANSFORM_ENABLE
@@ -0,0 +1,94 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "compiler_support.h"
+#include "report.h"
+#include "util.h"
+
+/* Fixed point values used by the transform have 8 fractional bits. */
+#define POINTING_DEVICE_TRANSFORM_ONE 256
+
+#ifndef POINTING_DEVICE_SENSITIVITY_DEFAULT
+// pointer speed in 1/16th, 16 moves the pointer one count per sensor count
+#    define POINTING_DEVICE_SENSITIVITY_DEFAULT 16
+#endif
+
+#ifndef POINTING_DEVICE_ACCELERATION_DEFAULT
+// how much of the acceleration curve is applied, 0 (none) to 255 (all of it)
+#    define POINTING_DEVICE_ACCELERATION_DEFAULT 0
+#endif
+
+#ifndef POINTING_DEVICE_SCROLL_DIVISOR_DEFAULT
+// sensor counts per wheel step while drag scrolling
+#    define POINTING_DEVICE_SCROLL_DIVISOR_DEFAULT 16
+#endif
+
+#ifndef POINTING_DEVICE_ACCELERATION_CURVE
+// { speed in sensor counts per report, gain with 8 fractional bits }
+#    define POINTING_DEVICE_ACCELERATION_CURVE \
+        { {0, 256}, {4, 256}, {16, 384}, {48, 768}, {128, 1024} }
+#endif
+
+typedef union pointing_device_config_t {
+    uint32_t raw;
+    struct PACKED {
+        uint8_t sensitivity;
+        uint8_t acceleration;
+        uint8_t scroll_divisor;
+        uint8_t reserved;
+    };
+} pointing_device_config_t;
+
+STATIC_ASSERT(sizeof(pointing_device_config_t) == sizeof(uint32_t), "Pointing device EECONFIG out of spec.");
+
+typedef struct {
+    uint16_t speed;
+    uint16_t gain;
+} pointing_device_curve_point_t;
+
+void eeconfig_update_pointing_device_default(void);
+
+/**
+ * @brief Load the transform settings from EEPROM and clear the accumulators.
+ */
+void pointing_device_transform_init(void);
+
+/**
+ * @brief Scale a report by the sensitivity and acceleration curve.
+ *
+ * Each axis keeps the fraction of a count that didn't make it into the
+ * report, so slow movements and low sensitivities don't lose motion. While
+ * drag scrolling, x and y are turned into h and v instead, scaled to the high
+ * resolution wheel when POINTING_DEVICE_HIRES_SCROLL_ENABLE is defined.
+ */
+report_mouse_t pointing_device_transform(report_mouse_t mouse_report);
+
+/**
+ * @brief Gain applied to a movement of `speed` sensor counts per report, with
+ * 8 fractional bits.
+ *
+ * Interpolates between the points of POINTING_DEVICE_ACCELERATION_CURVE and
+ * blends the result with a gain of 1 by the acceleration setting.
+ */
+uint16_t pointing_device_get_acceleration_gain(uint16_t speed);
+
+pointing_device_config_t pointing_device_get_config(void);
+void                     pointing_device_set_config(pointing_device_config_t config);
+void                     pointing_device_set_config_noeeprom(pointing_device_config_t config);
+
+uint8_t pointing_device_get_sensitivity(void);
+void    pointing_device_set_sensitivity(uint8_t sensitivity);
+void    pointing_device_set_sensitivity_noeeprom(uint8_t sensitivity);
+uint8_t pointing_device_get_acceleration(void);
+void    pointing_device_set_acceleration(uint8_t acceleration);
+void    pointing_device_set_acceleration_noeeprom(uint8_t acceleration);
+uint8_t pointing_device_get_scroll_divisor(void);
+void    pointing_device_set_scroll_divisor(uint8_t divisor);
+void    pointing_device_set_scroll_divisor_noeeprom(uint8_t divisor);
+
+bool pointing_device_get_drag_scroll(void);
+void pointing_device_set_drag_scroll(bool enable);
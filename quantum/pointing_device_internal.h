@@ -12,3 +12,13 @@
         do {                \
         } while (0)
 #endif
+
+#ifdef POINTING_DEVICE_MOTION_INTERRUPT
+#    include <ch.h>
+// Sensors are read from a high priority thread, which has to sleep through
+// longer sensor delays instead of spinning so the main loop keeps scanning
+#    define pd_wait_us(us) chThdSleepMicroseconds(us)
+#else
+#    include "wait.h"
+#    define pd_wait_us(us) wait_us(us)
+#endif
@@ -4,6 +4,10 @@
 #include "raw_hid.h"
 #include "host.h"
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_STATS)
+#    include "transactions.h"
+#endif
+
 void raw_hid_send(uint8_t *data, uint8_t length) {
     host_raw_hid_send(data, length);
 }
@@ -12,4 +16,9 @@ __attribute__((weak)) void raw_hid_receive(uint8_t *data, uint8_t length) {
     // Users should #include "raw_hid.h" in their own code
     // and implement this function there. Leave this as weak linkage
     // so users can opt to not handle data coming in.
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_STATS)
+    if (split_transaction_stats_raw_hid(data, length)) {
+        raw_hid_send(data, length);
+    }
+#endif
 }
@@ -5,14 +5,14 @@ RGB_MATRIX_EFFECT(ALPHAS_MODS)
 // alphas = color1, mods = color2
 bool ALPHAS_MODS(effect_params_t* params) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
+    params->idle = true; // only depends on the config
 
     hsv_t hsv  = rgb_matrix_config.hsv;
     rgb_t rgb1 = rgb_matrix_hsv_to_rgb(hsv);
     hsv.h += rgb_matrix_config.speed;
     rgb_t rgb2 = rgb_matrix_hsv_to_rgb(hsv);
 
-    for (uint8_t i = led_min; i < led_max; i++) {
-        RGB_MATRIX_TEST_LED_FLAGS();
+    RGB_MATRIX_FOREACH_LED(i, led_min, led_max) {
         if (HAS_FLAGS(g_led_config.flags[i], LED_FLAG_MODIFIER)) {
             rgb_matrix_set_color(i, rgb2.r, rgb2.g, rgb2.b);
         } else {
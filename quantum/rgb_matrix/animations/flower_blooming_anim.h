@@ -20,12 +20,11 @@ RGB_MATRIX_EFFECT(FLOWER_BLOOMING)
 
 typedef hsv_t (*flower_blooming_f)(hsv_t hsv, uint8_t i, uint8_t time);
 
-bool effect_runner_bloom(effect_params_t* params, flower_blooming_f effect_func) {
+RGB_MATRIX_RUNNER bool effect_runner_bloom(effect_params_t* params, flower_blooming_f effect_func) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
 
     uint8_t time = scale16by8(g_rgb_timer, qadd8(rgb_matrix_config.speed / 10, 1));
-    for (uint8_t i = led_min; i < led_max; i++) {
-        RGB_MATRIX_TEST_LED_FLAGS();
+    RGB_MATRIX_FOREACH_LED(i, led_min, led_max) {
         if (g_led_config.point[i].y > k_rgb_matrix_center.y) {
             rgb_t bgr = rgb_matrix_hsv_to_rgb(effect_func(rgb_matrix_config.hsv, i, time));
             rgb_matrix_set_color(i, bgr.b, bgr.g, bgr.r);
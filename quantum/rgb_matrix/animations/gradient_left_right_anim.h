@@ -4,11 +4,11 @@ RGB_MATRIX_EFFECT(GRADIENT_LEFT_RIGHT)
 
 bool GRADIENT_LEFT_RIGHT(effect_params_t* params) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
+    params->idle = true; // only depends on the config
 
     hsv_t   hsv   = rgb_matrix_config.hsv;
     uint8_t scale = scale8(64, rgb_matrix_config.speed);
-    for (uint8_t i = led_min; i < led_max; i++) {
-        RGB_MATRIX_TEST_LED_FLAGS();
+    RGB_MATRIX_FOREACH_LED(i, led_min, led_max) {
         // The x range will be 0..224, map this to 0..7
         // Relies on hue being 8-bit and wrapping
         hsv.h     = rgb_matrix_config.hsv.h + (scale * g_led_config.point[i].x >> 5);
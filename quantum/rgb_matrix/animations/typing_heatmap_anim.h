@@ -16,33 +16,74 @@ RGB_MATRIX_EFFECT(TYPING_HEATMAP)
 #        ifndef RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT
 #            define RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT 16
 #        endif
+// Matrix positions with a non-zero heat value, so cooling down only visits warm keys
+static matrix_row_t heatmap_warm_keys[MATRIX_ROWS];
+
+static void heatmap_add(uint8_t row, uint8_t col, uint8_t amount) {
+    g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], amount);
+    heatmap_warm_keys[row] |= MATRIX_ROW_SHIFTER << col;
+}
+
+static bool heatmap_is_cool(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        if (heatmap_warm_keys[row]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void heatmap_cool_down(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        matrix_row_t warm = heatmap_warm_keys[row];
+        for (uint8_t col = 0; warm; col++, warm >>= 1) {
+            if (!(warm & 1)) {
+                continue;
+            }
+            g_rgb_frame_buffer[row][col] = qsub8(g_rgb_frame_buffer[row][col], 1);
+            if (!g_rgb_frame_buffer[row][col]) {
+                heatmap_warm_keys[row] &= ~(MATRIX_ROW_SHIFTER << col);
+            }
+        }
+    }
+}
+
 void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
 #        ifdef RGB_MATRIX_TYPING_HEATMAP_SLIM
     // Limit effect to pressed keys
-    g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+    heatmap_add(row, col, RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
 #        else
     if (g_led_config.matrix_co[row][col] == NO_LED) { // skip as pressed key doesn't have an led position
         return;
     }
+    led_point_t origin = g_led_config.point[g_led_config.matrix_co[row][col]];
     for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
         for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
             if (g_led_config.matrix_co[i_row][i_col] == NO_LED) { // skip as target key doesn't have an led position
                 continue;
             }
             if (i_row == row && i_col == col) {
-                g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
-            } else {
-#            define LED_DISTANCE(led_a, led_b) sqrt16(((int32_t)(led_a.x - led_b.x) * (int32_t)(led_a.x - led_b.x)) + ((int32_t)(led_a.y - led_b.y) * (int32_t)(led_a.y - led_b.y)))
-                uint8_t distance = LED_DISTANCE(g_led_config.point[g_led_config.matrix_co[row][col]], g_led_config.point[g_led_config.matrix_co[i_row][i_col]]);
-#            undef LED_DISTANCE
-                if (distance <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
-                    uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
-                    if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
-                        amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
-                    }
-                    g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], amount);
-                }
+                heatmap_add(row, col, RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+                continue;
+            }
+
+            // reject keys outside the spread cheaply, so only neighbours pay for the square root
+            led_point_t target = g_led_config.point[g_led_config.matrix_co[i_row][i_col]];
+            int16_t     dx     = target.x - origin.x;
+            int16_t     dy     = target.y - origin.y;
+            if (abs(dx) > RGB_MATRIX_TYPING_HEATMAP_SPREAD || abs(dy) > RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+                continue;
             }
+            uint32_t distance_sq = (int32_t)dx * dx + (int32_t)dy * dy;
+            if (distance_sq > (uint32_t)RGB_MATRIX_TYPING_HEATMAP_SPREAD * RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+                continue;
+            }
+
+            uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, sqrt16(distance_sq));
+            if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
+                amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
+            }
+            heatmap_add(i_row, i_col, amount);
         }
     }
 #        endif
@@ -50,8 +91,6 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
 
 // A timer to track the last time we decremented all heatmap values.
 static uint16_t heatmap_decrease_timer;
-// Whether we should decrement the heatmap values during the next update.
-static bool decrease_heatmap_values;
 
 bool TYPING_HEATMAP(effect_params_t* params) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
@@ -59,21 +98,30 @@ bool TYPING_HEATMAP(effect_params_t* params) {
     if (params->init) {
         rgb_matrix_set_color_all(0, 0, 0);
         memset(g_rgb_frame_buffer, 0, sizeof g_rgb_frame_buffer);
+        memset(heatmap_warm_keys, 0, sizeof heatmap_warm_keys);
     }
 
     // The heatmap animation might run in several iterations depending on
     // `RGB_MATRIX_LED_PROCESS_LIMIT`, therefore we only want to update the
     // timer when the animation starts.
     if (params->iter == 0) {
-        decrease_heatmap_values = timer_elapsed(heatmap_decrease_timer) >= RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS;
-
         // Restart the timer if we are going to decrease the heatmap this frame.
-        if (decrease_heatmap_values) {
+        if (timer_elapsed(heatmap_decrease_timer) >= RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS) {
             heatmap_decrease_timer = timer_read();
+            heatmap_cool_down();
+        }
+    }
+
+    // Nothing to draw but black once every key has cooled down
+    if (heatmap_is_cool()) {
+        params->idle = true;
+        RGB_MATRIX_FOREACH_LED(i, led_min, led_max) {
+            rgb_matrix_set_color(i, 0, 0, 0);
         }
+        return rgb_matrix_check_finished_leds(led_max);
     }
 
-    // Render heatmap & decrease
+    // Render heatmap
     uint8_t count = 0;
     for (uint8_t row = 0; row < MATRIX_ROWS && count < RGB_MATRIX_LED_PROCESS_LIMIT; row++) {
         for (uint8_t col = 0; col < MATRIX_COLS && RGB_MATRIX_LED_PROCESS_LIMIT; col++) {
@@ -85,10 +133,6 @@ bool TYPING_HEATMAP(effect_params_t* params) {
                 hsv_t hsv = {170 - qsub8(val, 85), rgb_matrix_config.hsv.s, scale8((qadd8(170, val) - 170) * 3, rgb_matrix_config.hsv.v)};
                 rgb_t rgb = rgb_matrix_hsv_to_rgb(hsv);
                 rgb_matrix_set_color(g_led_config.matrix_co[row][col], rgb.r, rgb.g, rgb.b);
-
-                if (decrease_heatmap_values) {
-                    g_rgb_frame_buffer[row][col] = qsub8(val, 1);
-                }
             }
         }
     }
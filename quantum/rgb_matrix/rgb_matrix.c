@@ -20,6 +20,12 @@
 #include "progmem.h"
 #include "eeconfig.h"
 #include "keyboard.h"
+#ifdef RGB_MATRIX_SKIP_STATIC_FRAMES
+#    include "host.h"
+#    include "action_layer.h"
+#    include "action_util.h"
+#endif
+#include "matrix.h"
 #include "sync_timer.h"
 #include "debug.h"
 #include <string.h>
@@ -71,6 +77,9 @@ uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_INLINE_RUNNERS
+rgb_flagged_leds_t g_rgb_flagged_leds;
+#endif // RGB_MATRIX_INLINE_RUNNERS
 
 #ifndef RGB_MATRIX_FLAG_STEPS
 #    define RGB_MATRIX_FLAG_STEPS {LED_FLAG_ALL, LED_FLAG_KEYLIGHT | LED_FLAG_MODIFIER, LED_FLAG_UNDERGLOW, LED_FLAG_NONE}
@@ -83,9 +92,26 @@ static bool            suspend_state      = false;
 static uint8_t         rgb_last_enable    = UINT8_MAX;
 static uint8_t         rgb_last_effect    = UINT8_MAX;
 static uint8_t         rgb_current_effect = 0;
-static effect_params_t rgb_effect_params  = {0, LED_FLAG_ALL, false};
+static effect_params_t rgb_effect_params  = {0, LED_FLAG_ALL, false, false};
 static rgb_task_states rgb_task_state     = SYNCING;
 
+#ifdef RGB_MATRIX_SKIP_STATIC_FRAMES
+// everything the last frame could have depended on, while it was idle
+typedef struct PACKED {
+    uint64_t      config;
+    uint32_t      last_input;
+    layer_state_t layers;
+    layer_state_t default_layers;
+    uint8_t       host_leds;
+    uint8_t       mods;
+    bool          suspended;
+} rgb_frame_state_t;
+
+static rgb_frame_state_t rgb_frame_state;
+static bool              rgb_frame_idle       = false;
+static bool              rgb_redraw_requested = false;
+#endif // RGB_MATRIX_SKIP_STATIC_FRAMES
+
 // double buffers
 static uint32_t rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
@@ -166,11 +192,17 @@ __attribute__((weak)) int rgb_matrix_led_index(int index) {
 }
 
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+#ifdef RGB_MATRIX_LED_FRAMEBUFFER
+    rgb_matrix_framebuffer_set_color(index, red, green, blue);
+#else
     rgb_matrix_driver.set_color(rgb_matrix_led_index(index), red, green, blue);
+#endif
 }
 
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
-#if defined(RGB_MATRIX_SPLIT)
+#if defined(RGB_MATRIX_LED_FRAMEBUFFER)
+    rgb_matrix_framebuffer_set_color_all(red, green, blue);
+#elif defined(RGB_MATRIX_SPLIT)
     for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++)
         rgb_matrix_set_color(i, red, green, blue);
 #else
@@ -178,6 +210,31 @@ void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 #endif
 }
 
+#ifdef RGB_MATRIX_INLINE_RUNNERS
+static void rgb_matrix_update_flagged_leds(led_flags_t flags) {
+    g_rgb_flagged_leds.count = 0;
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        if (HAS_ANY_FLAGS(g_led_config.flags[i], flags)) {
+            g_rgb_flagged_leds.index[g_rgb_flagged_leds.count++] = i;
+        }
+    }
+}
+
+uint8_t rgb_matrix_flagged_leds_lower_bound(uint8_t led_min) {
+    // index list is sorted, so find the first entry >= led_min
+    uint8_t lo = 0, hi = g_rgb_flagged_leds.count;
+    while (lo < hi) {
+        uint8_t mid = lo + (hi - lo) / 2;
+        if (g_rgb_flagged_leds.index[mid] < led_min) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+#endif // RGB_MATRIX_INLINE_RUNNERS
+
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
 #ifndef RGB_MATRIX_SPLIT
     if (!is_keyboard_master()) return;
@@ -196,21 +253,8 @@ void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
         led_count = rgb_matrix_map_row_column_to_led(row, col, led);
     }
 
-    if (last_hit_buffer.count + led_count > LED_HITS_TO_REMEMBER) {
-        memcpy(&last_hit_buffer.x[0], &last_hit_buffer.x[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.y[0], &last_hit_buffer.y[led_count], LED_HITS_TO_REMEMBER - led_count);
-        memcpy(&last_hit_buffer.tick[0], &last_hit_buffer.tick[led_count], (LED_HITS_TO_REMEMBER - led_count) * 2); // 16 bit
-        memcpy(&last_hit_buffer.index[0], &last_hit_buffer.index[led_count], LED_HITS_TO_REMEMBER - led_count);
-        last_hit_buffer.count = LED_HITS_TO_REMEMBER - led_count;
-    }
-
     for (uint8_t i = 0; i < led_count; i++) {
-        uint8_t index                = last_hit_buffer.count;
-        last_hit_buffer.x[index]     = g_led_config.point[led[i]].x;
-        last_hit_buffer.y[index]     = g_led_config.point[led[i]].y;
-        last_hit_buffer.index[index] = led[i];
-        last_hit_buffer.tick[index]  = 0;
-        last_hit_buffer.count++;
+        led_hit_tracker_add(&last_hit_buffer, led[i], g_led_config.point[led[i]].x, g_led_config.point[led[i]].y);
     }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
@@ -269,19 +313,43 @@ static void rgb_task_timers(void) {
 
     // Update double buffer last hit timers
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
-    uint8_t count = last_hit_buffer.count;
-    for (uint8_t i = 0; i < count; ++i) {
-        if (UINT16_MAX - deltaTime < last_hit_buffer.tick[i]) {
-            last_hit_buffer.count--;
-            continue;
-        }
-        last_hit_buffer.tick[i] += deltaTime;
-    }
+    led_hit_tracker_tick(&last_hit_buffer, deltaTime);
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 }
 
+static bool rgb_task_suspended(void) {
+    return suspend_state ||
+#if RGB_MATRIX_TIMEOUT > 0
+           (last_input_activity_elapsed() > (uint32_t)RGB_MATRIX_TIMEOUT) ||
+#endif // RGB_MATRIX_TIMEOUT > 0
+           false;
+}
+
+#ifdef RGB_MATRIX_SKIP_STATIC_FRAMES
+static void rgb_frame_state_capture(rgb_frame_state_t *state, bool suspended) {
+    state->config         = rgb_matrix_config.raw;
+    state->last_input     = last_input_activity_time();
+    state->layers         = layer_state;
+    state->default_layers = default_layer_state;
+    state->host_leds      = host_keyboard_leds();
+    state->mods           = get_mods();
+    state->suspended      = suspended;
+}
+
+static bool rgb_frame_state_changed(void) {
+    rgb_frame_state_t current;
+    rgb_frame_state_capture(&current, rgb_task_suspended());
+    return memcmp(&current, &rgb_frame_state, sizeof(current)) != 0;
+}
+#endif // RGB_MATRIX_SKIP_STATIC_FRAMES
+
 static void rgb_task_sync(void) {
     eeconfig_flush_rgb_matrix(false);
+#ifdef RGB_MATRIX_SKIP_STATIC_FRAMES
+    // keep showing an idle frame until something it depends on changes
+    if (rgb_frame_idle && !rgb_redraw_requested && !rgb_frame_state_changed()) return;
+    rgb_redraw_requested = false;
+#endif // RGB_MATRIX_SKIP_STATIC_FRAMES
     // next task
     if (sync_timer_elapsed32(g_rgb_timer) >= RGB_MATRIX_LED_FLUSH_LIMIT) rgb_task_state = STARTING;
 }
@@ -296,13 +364,19 @@ static void rgb_task_start(void) {
     g_last_hit_tracker = last_hit_buffer;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+#ifdef RGB_MATRIX_LED_FRAMEBUFFER
+    // indicators are redrawn every frame
+    rgb_matrix_framebuffer_clear_layer(RGB_MATRIX_LAYER_INDICATOR);
+#endif // RGB_MATRIX_LED_FRAMEBUFFER
+
     // Ideally we would also stop sending zeros to the LED driver PWM buffers
     // while suspended and just do a software shutdown. This is a cheap hack for now.
-    bool suspend_backlight = suspend_state ||
-#if RGB_MATRIX_TIMEOUT > 0
-                             (last_input_activity_elapsed() > (uint32_t)RGB_MATRIX_TIMEOUT) ||
-#endif // RGB_MATRIX_TIMEOUT > 0
-                             false;
+    bool suspend_backlight = rgb_task_suspended();
+
+#ifdef RGB_MATRIX_SKIP_STATIC_FRAMES
+    rgb_frame_state_capture(&rgb_frame_state, suspend_backlight);
+    rgb_effect_params.idle = false;
+#endif // RGB_MATRIX_SKIP_STATIC_FRAMES
 
     // Set effect to be renedered
     rgb_current_effect = suspend_backlight || !rgb_matrix_config.enable ? 0 : rgb_matrix_config.mode;
@@ -316,6 +390,9 @@ static void rgb_task_render(uint8_t effect) {
     rgb_effect_params.init = (effect != rgb_last_effect) || (rgb_matrix_config.enable != rgb_last_enable);
     if (rgb_effect_params.flags != rgb_matrix_config.flags) {
         rgb_effect_params.flags = rgb_matrix_config.flags;
+#ifdef RGB_MATRIX_INLINE_RUNNERS
+        rgb_matrix_update_flagged_leds(rgb_effect_params.flags);
+#endif // RGB_MATRIX_INLINE_RUNNERS
         rgb_matrix_set_color_all(0, 0, 0);
     }
 
@@ -372,6 +449,10 @@ static void rgb_task_render(uint8_t effect) {
 
     // next task
     if (!rendering) {
+#ifdef RGB_MATRIX_SKIP_STATIC_FRAMES
+        // nothing is drawn while the matrix is off, so that frame never changes either
+        rgb_frame_idle = rgb_effect_params.idle || effect == RGB_MATRIX_NONE;
+#endif // RGB_MATRIX_SKIP_STATIC_FRAMES
         rgb_task_state = FLUSHING;
         if (!rgb_effect_params.init && effect == RGB_MATRIX_NONE) {
             // We only need to flush once if we are RGB_MATRIX_NONE
@@ -385,6 +466,20 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_last_effect = effect;
     rgb_last_enable = rgb_matrix_config.enable;
 
+#ifdef RGB_MATRIX_LED_FRAMEBUFFER
+    // composite the layers into the driver buffer, overlays are only shown while an effect is running
+    uint8_t led_min = 0;
+    uint8_t led_max = RGB_MATRIX_LED_COUNT;
+#    if defined(RGB_MATRIX_SPLIT)
+    if (is_keyboard_left()) {
+        led_max = k_rgb_matrix_split[0];
+    } else {
+        led_min = k_rgb_matrix_split[0];
+    }
+#    endif
+    rgb_matrix_framebuffer_compose(led_min, led_max, effect != RGB_MATRIX_NONE);
+#endif // RGB_MATRIX_LED_FRAMEBUFFER
+
     // update pwm buffers
     rgb_matrix_update_pwm_buffers();
 
@@ -401,15 +496,26 @@ void rgb_matrix_task(void) {
         case STARTING:
             rgb_task_start();
             break;
-        case RENDERING:
+        case RENDERING: {
+#ifdef RGB_MATRIX_LED_FRAMEBUFFER
+            uint8_t layer = rgb_matrix_framebuffer_get_layer();
+            rgb_matrix_framebuffer_select_layer(RGB_MATRIX_LAYER_EFFECT);
+#endif // RGB_MATRIX_LED_FRAMEBUFFER
             rgb_task_render(effect);
             if (effect) {
+#ifdef RGB_MATRIX_LED_FRAMEBUFFER
+                rgb_matrix_framebuffer_select_layer(RGB_MATRIX_LAYER_INDICATOR);
+#endif // RGB_MATRIX_LED_FRAMEBUFFER
                 if (rgb_task_state == FLUSHING) { // ensure we only draw basic indicators once rendering is finished
                     rgb_matrix_indicators();
                 }
                 rgb_matrix_indicators_advanced(&rgb_effect_params);
             }
+#ifdef RGB_MATRIX_LED_FRAMEBUFFER
+            rgb_matrix_framebuffer_select_layer(layer);
+#endif // RGB_MATRIX_LED_FRAMEBUFFER
             break;
+        }
         case FLUSHING:
             rgb_task_flush(effect);
             break;
@@ -487,19 +593,26 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
     return true;
 }
 
+void rgb_matrix_request_redraw(void) {
+#ifdef RGB_MATRIX_SKIP_STATIC_FRAMES
+    rgb_redraw_requested = true;
+#endif // RGB_MATRIX_SKIP_STATIC_FRAMES
+}
+
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
-#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
-    g_last_hit_tracker.count = 0;
-    for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
-        g_last_hit_tracker.tick[i] = UINT16_MAX;
-    }
+#ifdef RGB_MATRIX_LED_FRAMEBUFFER
+    rgb_matrix_framebuffer_init();
+#endif // RGB_MATRIX_LED_FRAMEBUFFER
 
-    last_hit_buffer.count = 0;
-    for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
-        last_hit_buffer.tick[i] = UINT16_MAX;
-    }
+#ifdef RGB_MATRIX_INLINE_RUNNERS
+    rgb_matrix_update_flagged_leds(rgb_effect_params.flags);
+#endif // RGB_MATRIX_INLINE_RUNNERS
+
+#ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
+    led_hit_tracker_init(&g_last_hit_tracker);
+    led_hit_tracker_init(&last_hit_buffer);
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
     eeconfig_init_rgb_matrix();
@@ -513,8 +626,11 @@ void rgb_matrix_init(void) {
 void rgb_matrix_set_suspend_state(bool state) {
 #ifdef RGB_MATRIX_SLEEP
     if (state && !suspend_state) { // only run if turning off, and only once
-        rgb_task_render(0);        // turn off all LEDs when suspending
-        rgb_task_flush(0);         // and actually flash led state to LEDs
+#    ifdef RGB_MATRIX_LED_FRAMEBUFFER
+        rgb_matrix_framebuffer_select_layer(RGB_MATRIX_LAYER_EFFECT);
+#    endif
+        rgb_task_render(0); // turn off all LEDs when suspending
+        rgb_task_flush(0);  // and actually flash led state to LEDs
     }
     suspend_state = state;
 #endif
@@ -22,6 +22,7 @@
 #include <stdbool.h>
 #include "rgb_matrix_types.h"
 #include "rgb_matrix_drivers.h"
+#include "rgb_matrix_framebuffer.h"
 #include "color.h"
 #include "keyboard.h"
 
@@ -114,6 +115,20 @@ struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter);
 #define RGB_MATRIX_TEST_LED_FLAGS() \
     if (!HAS_ANY_FLAGS(g_led_config.flags[i], params->flags)) continue
 
+#ifdef RGB_MATRIX_INLINE_RUNNERS
+// Runners are instantiated into every effect so the effect math is inlined into the LED loop
+#    define RGB_MATRIX_RUNNER __attribute__((always_inline)) static inline
+// Iterates only the LEDs matching params->flags, using the precomputed index list
+#    define RGB_MATRIX_FOREACH_LED(i, min, max)                                 \
+        for (uint8_t i##_pos = rgb_matrix_flagged_leds_lower_bound(min), i; \
+             i##_pos < g_rgb_flagged_leds.count && (i = g_rgb_flagged_leds.index[i##_pos]) < (max); i##_pos++)
+#else
+#    define RGB_MATRIX_RUNNER
+#    define RGB_MATRIX_FOREACH_LED(i, min, max) \
+        for (uint8_t i = min; i < (max); i++)   \
+            if (HAS_ANY_FLAGS(g_led_config.flags[i], params->flags))
+#endif
+
 enum rgb_matrix_effects {
     RGB_MATRIX_NONE = 0,
 
@@ -172,6 +187,9 @@ bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
 void rgb_matrix_init(void);
 
+// Redraw even if the last frame was idle, for indicators that depend on state the matrix doesn't track
+void rgb_matrix_request_redraw(void);
+
 void rgb_matrix_reload_from_eeprom(void);
 
 void        rgb_matrix_set_suspend_state(bool state);
@@ -294,3 +312,13 @@ extern last_hit_t g_last_hit_tracker;
 #ifdef RGB_MATRIX_FRAMEBUFFER_EFFECTS
 extern uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS];
 #endif
+#ifdef RGB_MATRIX_INLINE_RUNNERS
+typedef struct {
+    uint8_t count;
+    uint8_t index[RGB_MATRIX_LED_COUNT];
+} rgb_flagged_leds_t;
+
+extern rgb_flagged_leds_t g_rgb_flagged_leds;
+
+uint8_t rgb_matrix_flagged_leds_lower_bound(uint8_t led_min);
+#endif // RGB_MATRIX_INLINE_RUNNERS
@@ -0,0 +1,154 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix.h"
+
+#ifdef RGB_MATRIX_LED_FRAMEBUFFER
+
+#    include <string.h>
+#    include "compiler_support.h"
+#    include <lib/lib8tion/lib8tion.h>
+
+typedef struct PACKED {
+    rgb_t   rgb;
+    uint8_t blend;
+} rgb_matrix_overlay_pixel_t;
+
+// bitmask of layers, bit 0 is the effect layer
+typedef uint16_t rgb_matrix_layer_mask_t;
+STATIC_ASSERT(RGB_MATRIX_LAYER_COUNT <= 16, "RGB_MATRIX_FRAMEBUFFER_OVERLAYS must be 14 or less");
+
+static rgb_t                      effect_layer[RGB_MATRIX_LED_COUNT];
+static rgb_matrix_overlay_pixel_t overlay_layers[RGB_MATRIX_LAYER_COUNT - 1][RGB_MATRIX_LED_COUNT];
+
+static uint8_t                 current_layer = RGB_MATRIX_LAYER_EFFECT;
+static rgb_matrix_blend_t      current_blend = RGB_MATRIX_BLEND_REPLACE;
+static rgb_matrix_layer_mask_t enabled_layers;
+static rgb_matrix_layer_mask_t drawn_layers;
+
+void rgb_matrix_framebuffer_init(void) {
+    memset(effect_layer, 0, sizeof(effect_layer));
+    memset(overlay_layers, 0, sizeof(overlay_layers));
+    current_layer  = RGB_MATRIX_LAYER_EFFECT;
+    current_blend  = RGB_MATRIX_BLEND_REPLACE;
+    enabled_layers = (1 << RGB_MATRIX_LAYER_EFFECT) | (1 << RGB_MATRIX_LAYER_INDICATOR);
+    drawn_layers   = 0;
+}
+
+void rgb_matrix_framebuffer_select_layer(uint8_t layer) {
+    if (layer < RGB_MATRIX_LAYER_COUNT) {
+        current_layer = layer;
+    }
+}
+
+uint8_t rgb_matrix_framebuffer_get_layer(void) {
+    return current_layer;
+}
+
+void rgb_matrix_framebuffer_set_blend_mode(rgb_matrix_blend_t blend) {
+    current_blend = blend;
+}
+
+rgb_matrix_blend_t rgb_matrix_framebuffer_get_blend_mode(void) {
+    return current_blend;
+}
+
+void rgb_matrix_framebuffer_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    if (index < 0 || index >= RGB_MATRIX_LED_COUNT) {
+        return;
+    }
+
+    if (current_layer == RGB_MATRIX_LAYER_EFFECT) {
+        effect_layer[index] = (rgb_t){red, green, blue};
+        return;
+    }
+
+    rgb_matrix_overlay_pixel_t *pixel = &overlay_layers[current_layer - 1][index];
+    pixel->rgb                        = (rgb_t){red, green, blue};
+    pixel->blend                      = current_blend;
+    drawn_layers |= (1 << current_layer);
+}
+
+void rgb_matrix_framebuffer_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_matrix_framebuffer_set_color(i, red, green, blue);
+    }
+}
+
+void rgb_matrix_framebuffer_clear_layer(uint8_t layer) {
+    if (layer >= RGB_MATRIX_LAYER_COUNT) {
+        return;
+    }
+
+    if (layer == RGB_MATRIX_LAYER_EFFECT) {
+        memset(effect_layer, 0, sizeof(effect_layer));
+        return;
+    }
+
+    // nothing to do if the layer has not been drawn to since it was last cleared
+    if (drawn_layers & (1 << layer)) {
+        memset(overlay_layers[layer - 1], 0, sizeof(overlay_layers[0]));
+        drawn_layers &= ~(1 << layer);
+    }
+}
+
+void rgb_matrix_framebuffer_layer_enable(uint8_t layer, bool enable) {
+    // the effect and indicator layers are always composited
+    if (layer == RGB_MATRIX_LAYER_EFFECT || layer >= RGB_MATRIX_LAYER_INDICATOR) {
+        return;
+    }
+
+    if (enable) {
+        enabled_layers |= (1 << layer);
+    } else {
+        enabled_layers &= ~(1 << layer);
+    }
+}
+
+bool rgb_matrix_framebuffer_layer_is_enabled(uint8_t layer) {
+    return layer < RGB_MATRIX_LAYER_COUNT && (enabled_layers & (1 << layer));
+}
+
+static inline uint8_t blend_channel(uint8_t below, uint8_t above, uint8_t blend) {
+    switch (blend) {
+        case RGB_MATRIX_BLEND_REPLACE:
+            return above;
+        case RGB_MATRIX_BLEND_ADD:
+            return qadd8(below, above);
+        case RGB_MATRIX_BLEND_SUBTRACT:
+            return qsub8(below, above);
+        case RGB_MATRIX_BLEND_MULTIPLY:
+            return scale8(below, above);
+        case RGB_MATRIX_BLEND_AVERAGE:
+            return avg8(below, above);
+        default:
+            return below;
+    }
+}
+
+void rgb_matrix_framebuffer_compose(uint8_t led_min, uint8_t led_max, bool overlays) {
+    rgb_matrix_layer_mask_t layers = overlays ? (enabled_layers & drawn_layers) : 0;
+
+    for (uint8_t i = led_min; i < led_max; i++) {
+        rgb_t rgb = effect_layer[i];
+
+        for (uint8_t layer = RGB_MATRIX_LAYER_OVERLAY(0); layers >> layer; layer++) {
+            if (!(layers & (1 << layer))) {
+                continue;
+            }
+
+            const rgb_matrix_overlay_pixel_t *pixel = &overlay_layers[layer - 1][i];
+            if (pixel->blend == RGB_MATRIX_BLEND_NONE) {
+                continue;
+            }
+
+            rgb.r = blend_channel(rgb.r, pixel->rgb.r, pixel->blend);
+            rgb.g = blend_channel(rgb.g, pixel->rgb.g, pixel->blend);
+            rgb.b = blend_channel(rgb.b, pixel->rgb.b, pixel->blend);
+        }
+
+        rgb_matrix_driver.set_color(rgb_matrix_led_index(i), rgb.r, rgb.g, rgb.b);
+    }
+}
+
+#endif // RGB_MATRIX_LED_FRAMEBUFFER
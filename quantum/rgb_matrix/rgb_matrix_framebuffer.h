@@ -0,0 +1,54 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef RGB_MATRIX_LED_FRAMEBUFFER
+
+#    ifndef RGB_MATRIX_FRAMEBUFFER_OVERLAYS
+#        define RGB_MATRIX_FRAMEBUFFER_OVERLAYS 0
+#    endif
+
+/* Layers are composited bottom to top: the effect layer, then every enabled
+ * overlay, then the indicator layer. The effect layer is opaque; overlay and
+ * indicator pixels are transparent until written, and are blended onto the
+ * layers below using the blend mode they were written with.
+ */
+#    define RGB_MATRIX_LAYER_EFFECT 0
+#    define RGB_MATRIX_LAYER_OVERLAY(n) (1 + (n))
+#    define RGB_MATRIX_LAYER_INDICATOR (1 + RGB_MATRIX_FRAMEBUFFER_OVERLAYS)
+#    define RGB_MATRIX_LAYER_COUNT (2 + RGB_MATRIX_FRAMEBUFFER_OVERLAYS)
+
+typedef enum rgb_matrix_blend_t {
+    RGB_MATRIX_BLEND_NONE = 0, // transparent, the pixel is not drawn
+    RGB_MATRIX_BLEND_REPLACE,
+    RGB_MATRIX_BLEND_ADD,
+    RGB_MATRIX_BLEND_SUBTRACT,
+    RGB_MATRIX_BLEND_MULTIPLY,
+    RGB_MATRIX_BLEND_AVERAGE,
+} rgb_matrix_blend_t;
+
+void rgb_matrix_framebuffer_init(void);
+
+/* Select the layer that rgb_matrix_set_color() and rgb_matrix_set_color_all() draw to. */
+void    rgb_matrix_framebuffer_select_layer(uint8_t layer);
+uint8_t rgb_matrix_framebuffer_get_layer(void);
+
+/* Select the blend mode used for subsequent writes to overlay and indicator layers. */
+void               rgb_matrix_framebuffer_set_blend_mode(rgb_matrix_blend_t blend);
+rgb_matrix_blend_t rgb_matrix_framebuffer_get_blend_mode(void);
+
+void rgb_matrix_framebuffer_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
+void rgb_matrix_framebuffer_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
+void rgb_matrix_framebuffer_clear_layer(uint8_t layer);
+
+void rgb_matrix_framebuffer_layer_enable(uint8_t layer, bool enable);
+bool rgb_matrix_framebuffer_layer_is_enabled(uint8_t layer);
+
+/* Composite the LEDs in [led_min, led_max) and write them to the driver buffer. */
+void rgb_matrix_framebuffer_compose(uint8_t led_min, uint8_t led_max, bool overlays);
+
+#endif // RGB_MATRIX_LED_FRAMEBUFFER
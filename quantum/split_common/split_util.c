@@ -121,6 +121,26 @@ void split_watchdog_task(void) {
 }
 #endif // defined(SPLIT_WATCHDOG_ENABLE)
 
+#if defined(SPLIT_SLAVE_DIRTY_PIN)
+// The slave pulls the dirty pin low while it has changes the master has not read yet.
+static void split_slave_dirty_init(void) {
+    if (is_keyboard_master()) {
+        gpio_set_pin_input_high(SPLIT_SLAVE_DIRTY_PIN);
+    } else {
+        gpio_set_pin_output(SPLIT_SLAVE_DIRTY_PIN);
+        gpio_write_pin_high(SPLIT_SLAVE_DIRTY_PIN);
+    }
+}
+
+void split_slave_set_dirty(bool dirty) {
+    gpio_write_pin(SPLIT_SLAVE_DIRTY_PIN, !dirty);
+}
+
+bool split_slave_is_dirty(void) {
+    return !gpio_read_pin(SPLIT_SLAVE_DIRTY_PIN);
+}
+#endif // defined(SPLIT_SLAVE_DIRTY_PIN)
+
 #ifdef SPLIT_HAND_MATRIX_GRID
 void matrix_io_delay(void);
 
@@ -215,6 +235,9 @@ void split_pre_init(void) {
 #endif
 
     if (is_keyboard_master()) {
+#if defined(SPLIT_SLAVE_DIRTY_PIN)
+        split_slave_dirty_init();
+#endif
         transport_master_init();
     }
 }
@@ -224,6 +247,11 @@ void split_pre_init(void) {
 //     receiving before the init process has completed
 void split_post_init(void) {
     if (!is_keyboard_master()) {
+#if defined(SPLIT_SLAVE_DIRTY_PIN)
+        // Start out dirty, so the master reads the initial state right away
+        split_slave_dirty_init();
+        split_slave_set_dirty(true);
+#endif
         transport_slave_init();
 #if defined(SPLIT_WATCHDOG_ENABLE)
         split_watchdog_init();
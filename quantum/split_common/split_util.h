@@ -13,6 +13,11 @@ void split_post_init(void);
 bool transport_master_if_connected(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 bool is_transport_connected(void);
 
+#if defined(SPLIT_SLAVE_DIRTY_PIN)
+void split_slave_set_dirty(bool dirty);
+bool split_slave_is_dirty(void);
+#endif
+
 void split_watchdog_update(bool done);
 void split_watchdog_task(void);
 bool split_watchdog_check(void);
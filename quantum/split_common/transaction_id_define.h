@@ -77,6 +77,11 @@ enum serial_transaction_id {
     PUT_OLED,
 #endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
+#if defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE)
+    PUT_OLED_BUFFER,
+    GET_OLED_BUFFER_ACK,
+#endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE)
+
 #if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
     PUT_ST7565,
 #endif // defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
@@ -64,6 +64,12 @@
 #ifdef WPM_ENABLE
 #    include "wpm.h"
 #endif
+#ifdef SPLIT_TRANSACTION_STATS
+#    include "print.h"
+#    ifdef PROTOCOL_CHIBIOS
+#        include <ch.h>
+#    endif
+#endif
 
 #define SYNC_TIMER_OFFSET 2
 
@@ -71,6 +77,15 @@
 #    define FORCED_SYNC_THROTTLE_MS 100
 #endif // FORCED_SYNC_THROTTLE_MS
 
+#if defined(SPLIT_SLAVE_DIRTY_PIN)
+#    ifndef SPLIT_SLAVE_HEARTBEAT_MS
+#        define SPLIT_SLAVE_HEARTBEAT_MS FORCED_SYNC_THROTTLE_MS
+#    elif SPLIT_SLAVE_HEARTBEAT_MS < FORCED_SYNC_THROTTLE_MS
+// Every heartbeat would also be a forced sync, i.e. a full read of the slave on every cycle.
+#        error SPLIT_SLAVE_HEARTBEAT_MS must not be lower than FORCED_SYNC_THROTTLE_MS
+#    endif
+#endif // defined(SPLIT_SLAVE_DIRTY_PIN)
+
 #define sizeof_member(type, member) sizeof(((type *)NULL)->member)
 
 #define trans_initiator2target_initializer_cb(member, cb) {sizeof_member(split_shared_memory_t, member), offsetof(split_shared_memory_t, member), 0, 0, cb}
@@ -81,9 +96,16 @@
 
 #define trans_initiator2target_cb(cb) {0, 0, 0, 0, cb}
 
-#define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
-#define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
-#define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
+#ifdef SPLIT_TRANSACTION_STATS
+static bool transport_execute_with_stats(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
+#    define transport_execute transport_execute_with_stats
+#else // SPLIT_TRANSACTION_STATS
+#    define transport_execute transport_execute_transaction
+#endif // SPLIT_TRANSACTION_STATS
+
+#define transport_write(id, data, length) transport_execute(id, data, length, NULL, 0)
+#define transport_read(id, data, length) transport_execute(id, NULL, 0, data, length)
+#define transport_exec(id) transport_execute(id, NULL, 0, NULL, 0)
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
@@ -141,17 +163,21 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         split_shared_memory_unlock();                         \
     } while (0)
 
-inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
+// The checksum doubles as the version of the slave's data: it is only compared
+// against the checksum of the last successful read. The data is read in place
+// into the shared memory, and only copied to destination, the last good copy,
+// once its checksum has been verified.
+inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, uint8_t *last_checksum, void *destination, void *equiv_shmem, size_t length) {
     uint8_t curr_checksum;
     bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
-    if (okay && (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(equiv_shmem, length))) {
-        okay &= transport_read(trans_id_retrieve, destination, length);
+    if (okay && (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != *last_checksum)) {
+        okay &= transport_read(trans_id_retrieve, equiv_shmem, length);
         okay &= curr_checksum == crc8(equiv_shmem, length);
         if (okay) {
-            *last_update = timer_read32();
+            memcpy(destination, equiv_shmem, length);
+            *last_update   = timer_read32();
+            *last_checksum = curr_checksum;
         }
-    } else {
-        memcpy(destination, equiv_shmem, length);
     }
     return okay;
 }
@@ -172,34 +198,180 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
     return send_if_condition(trans_id, last_update, (memcmp(source, equiv_shmem, length) != 0), source, length);
 }
 
+////////////////////////////////////////////////////
+// Statistics
+
+#ifdef SPLIT_TRANSACTION_STATS
+
+#    ifdef PROTOCOL_CHIBIOS
+// The system tick is the finest clock available on all ChibiOS ports
+typedef systime_t stats_time_t;
+#        define stats_time_read() chVTGetSystemTimeX()
+#        define stats_time_elapsed_us(start) ((uint32_t)TIME_I2US(chTimeDiffX((start), chVTGetSystemTimeX())))
+#    else // PROTOCOL_CHIBIOS
+typedef uint32_t stats_time_t;
+#        define stats_time_read() timer_read32()
+#        define stats_time_elapsed_us(start) (timer_elapsed32(start) * 1000)
+#    endif // PROTOCOL_CHIBIOS
+
+static split_transaction_stats_t stats[NUM_TOTAL_TRANSACTIONS];
+static uint16_t                  stats_cycles;
+static uint16_t                  stats_cycles_per_second;
+static uint32_t                  stats_cycle_timer;
+
+static bool transport_execute_with_stats(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    uint32_t     bytes = transport_transferred_bytes();
+    stats_time_t start = stats_time_read();
+    bool         okay  = transport_execute_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+    uint32_t     us    = stats_time_elapsed_us(start);
+
+    split_transaction_stats_t *s = &stats[id];
+    if (s->attempts == 0 || us < s->min_us) {
+        s->min_us = MIN(us, UINT16_MAX);
+    }
+    if (us > s->max_us) {
+        s->max_us = MIN(us, UINT16_MAX);
+    }
+    s->total_us += us;
+    s->attempts++;
+    s->bytes += transport_transferred_bytes() - bytes;
+    if (!okay) {
+        s->failures++;
+    }
+    return okay;
+}
+
+static void stats_cycle(void) {
+    stats_cycles++;
+    if (timer_elapsed32(stats_cycle_timer) >= 1000) {
+        stats_cycles_per_second = stats_cycles;
+        stats_cycles            = 0;
+        stats_cycle_timer       = timer_read32();
+
+#    if defined(SPLIT_TRANSACTION_STATS_PRINT_INTERVAL) && SPLIT_TRANSACTION_STATS_PRINT_INTERVAL > 0
+        static uint32_t last_print = 0;
+        if (timer_elapsed32(last_print) >= SPLIT_TRANSACTION_STATS_PRINT_INTERVAL) {
+            last_print = timer_read32();
+            split_transaction_stats_print();
+        }
+#    endif
+    }
+}
+
+const split_transaction_stats_t *split_transaction_stats_get(int8_t transaction_id) {
+    if (transaction_id < 0 || transaction_id >= NUM_TOTAL_TRANSACTIONS) {
+        return NULL;
+    }
+    return &stats[transaction_id];
+}
+
+uint16_t split_transaction_stats_cycles_per_second(void) {
+    return stats_cycles_per_second;
+}
+
+void split_transaction_stats_clear(void) {
+    memset(stats, 0, sizeof(stats));
+}
+
+void split_transaction_stats_print(void) {
+    uprintf("split: %u cycles/s\n", stats_cycles_per_second);
+    uprintf("  id   attempts   failures      bytes  min us  avg us  max us\n");
+    for (int8_t i = 0; i < NUM_TOTAL_TRANSACTIONS; i++) {
+        const split_transaction_stats_t *s = &stats[i];
+        if (s->attempts == 0) {
+            continue;
+        }
+        uprintf("%4d %10lu %10lu %10lu %7u %7lu %7u\n", i, (unsigned long)s->attempts, (unsigned long)s->failures, (unsigned long)s->bytes, s->min_us, (unsigned long)(s->total_us / s->attempts), s->max_us);
+    }
+}
+
+bool split_transaction_stats_raw_hid(uint8_t *data, uint8_t length) {
+    if (length < 2 + sizeof(split_transaction_stats_report_t) || data[0] != SPLIT_TRANSACTION_STATS_RAW_HID_ID) {
+        return false;
+    }
+
+    split_transaction_stats_report_t report = {
+        .count             = NUM_TOTAL_TRANSACTIONS,
+        .cycles_per_second = stats_cycles_per_second,
+    };
+    const split_transaction_stats_t *s = split_transaction_stats_get((int8_t)data[1]);
+    if (s) {
+        report.stats = *s;
+    }
+    memcpy(&data[2], &report, sizeof(report));
+    return true;
+}
+
+#    define TRANSACTIONS_STATS_MASTER() stats_cycle()
+
+#else // SPLIT_TRANSACTION_STATS
+
+#    define TRANSACTIONS_STATS_MASTER()
+
+#endif // SPLIT_TRANSACTION_STATS
+
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#if defined(SPLIT_SLAVE_DIRTY_PIN)
+// Whether the slave is read during the current master cycle.
+static bool slave_dirty = true;
+#endif // defined(SPLIT_SLAVE_DIRTY_PIN)
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
+    static uint8_t      last_checksum                  = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
-    matrix_row_t        temp_matrix[(MATRIX_ROWS) / 2];       // holding area while we test whether or not checksum is correct
 
-    bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
-    if (okay) {
-        // Checksum matches the received data, save as the last matrix state
-        memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
+#if defined(SPLIT_SLAVE_DIRTY_PIN)
+    // The slave signals changes on the dirty pin, so it only needs to be read
+    // then, or for the heartbeat which keeps the connection check alive.
+    slave_dirty = split_slave_is_dirty() || timer_elapsed32(last_update) >= SPLIT_SLAVE_HEARTBEAT_MS || !is_transport_connected();
+    if (!slave_dirty) {
+        memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
+        return true;
     }
+#endif // defined(SPLIT_SLAVE_DIRTY_PIN)
+
+    bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, &last_checksum, last_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
     // Copy out the last-known-good matrix state to the slave matrix
     memcpy(slave_matrix, last_matrix, sizeof(last_matrix));
     return okay;
 }
 
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static bool initialized = false;
+
+    // Only update the shared copy and its checksum when the matrix changed
+    if (initialized && memcmp(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix)) == 0) {
+        return;
+    }
+    initialized = true;
+
     memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
     split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+#if defined(SPLIT_SLAVE_DIRTY_PIN)
+    split_slave_set_dirty(true);
+#endif // defined(SPLIT_SLAVE_DIRTY_PIN)
+}
+
+#if defined(SPLIT_SLAVE_DIRTY_PIN)
+// The master reads the matrix checksum first whenever it reads the slave, so
+// anything that changes after this point signals the master again.
+static void slave_matrix_handlers_slave_read(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    split_slave_set_dirty(false);
 }
 
+#    define trans_slave_matrix_checksum_initializer() trans_target2initiator_initializer_cb(smatrix.checksum, slave_matrix_handlers_slave_read)
+#else // defined(SPLIT_SLAVE_DIRTY_PIN)
+#    define trans_slave_matrix_checksum_initializer() trans_target2initiator_initializer(smatrix.checksum)
+#endif // defined(SPLIT_SLAVE_DIRTY_PIN)
+
 // clang-format off
 #define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
-    [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
+    [GET_SLAVE_MATRIX_CHECKSUM] = trans_slave_matrix_checksum_initializer(), \
     [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
 // clang-format on
 
@@ -236,25 +408,29 @@ static void master_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_ro
 #ifdef ENCODER_ENABLE
 
 static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t  last_update   = 0;
-    static uint8_t   last_checksum = 0;
-    encoder_events_t temp_events;
+    static uint32_t         last_update        = 0;
+    static uint8_t          last_read_checksum = 0;
+    static uint8_t          last_checksum      = 0;
+    static encoder_events_t last_events; // last successfully-read events
+
+#    if defined(SPLIT_SLAVE_DIRTY_PIN)
+    if (!slave_dirty) {
+        return true;
+    }
+#    endif // defined(SPLIT_SLAVE_DIRTY_PIN)
 
-    bool okay = read_if_checksum_mismatch(GET_ENCODERS_CHECKSUM, GET_ENCODERS_DATA, &last_update, &temp_events, &split_shmem->encoders.events, sizeof(temp_events));
+    bool okay = read_if_checksum_mismatch(GET_ENCODERS_CHECKSUM, GET_ENCODERS_DATA, &last_update, &last_read_checksum, &last_events, &split_shmem->encoders.events, sizeof(last_events));
     if (okay) {
-        if (last_checksum != split_shmem->encoders.checksum) {
-            bool    actioned = false;
-            uint8_t index;
-            bool    clockwise;
-            while (okay && encoder_dequeue_event_advanced(&split_shmem->encoders.events, &index, &clockwise)) {
-                okay &= encoder_queue_event(index, clockwise);
-                actioned = true;
-            }
+        // Only events that were read and verified since they were last actioned
+        if (last_checksum != last_read_checksum) {
+            // Velocity uses the times the slave recorded, not when they were synced
+            bool actioned = !encoder_queue_empty_advanced(&last_events);
+            okay &= encoder_queue_remote_events(&last_events);
 
             if (actioned) {
                 okay &= transport_exec(CMD_ENCODER_DRAIN);
             }
-            last_checksum = split_shmem->encoders.checksum;
+            last_checksum = last_read_checksum;
         }
     }
     return okay;
@@ -264,7 +440,13 @@ static void encoder_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sl
     // Always prepare the encoder state for read.
     encoder_retrieve_events(&split_shmem->encoders.events);
     // Now update the checksum given that the encoders has been written to
-    split_shmem->encoders.checksum = crc8(&split_shmem->encoders.events, sizeof(split_shmem->encoders.events));
+    uint8_t checksum = crc8(&split_shmem->encoders.events, sizeof(split_shmem->encoders.events));
+#    if defined(SPLIT_SLAVE_DIRTY_PIN)
+    if (checksum != split_shmem->encoders.checksum) {
+        split_slave_set_dirty(true);
+    }
+#    endif // defined(SPLIT_SLAVE_DIRTY_PIN)
+    split_shmem->encoders.checksum = checksum;
 }
 
 static void encoder_handlers_slave_drain(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
@@ -662,6 +844,114 @@ static void oled_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave
 
 #endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
+////////////////////////////////////////////////////
+// OLED buffer
+
+#if defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE)
+
+#    ifndef SPLIT_OLED_BUFFER_BANDWIDTH
+#        define SPLIT_OLED_BUFFER_BANDWIDTH 2048
+#    endif // SPLIT_OLED_BUFFER_BANDWIDTH
+
+// Only one packet is in flight at a time: the next one is packed once the slave
+// has acknowledged applying the previous one.
+static bool oled_buffer_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static split_oled_buffer_sync_t packet;
+    static bool                     started     = false;
+    static bool                     pending     = false;
+    static uint8_t                  last_ack    = 0;
+    static uint32_t                 last_update = 0;
+    static uint32_t                 last_refill = 0;
+    static uint32_t                 budget      = 0;
+    // The budget is kept in bytes times milliseconds, so low rates aren't rounded away
+    const uint32_t cost = sizeof(packet) * 1000;
+
+    uint32_t now     = timer_read32();
+    uint32_t elapsed = MIN(TIMER_DIFF_32(now, last_refill), 1000);
+    budget           = MIN(budget + elapsed * SPLIT_OLED_BUFFER_BANDWIDTH, 2 * cost);
+    last_refill      = now;
+
+    // While nothing is pending the acknowledgement is still checked now and then, to notice a slave that restarted
+    bool idle_check = !pending && timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS;
+    if (pending || !started || idle_check) {
+        uint8_t ack;
+        if (!transport_read(GET_OLED_BUFFER_ACK, &ack, sizeof(ack))) {
+            return false;
+        }
+        if (!started) {
+            // Carry on from the slave's last packet, and send it the whole buffer
+            packet.sequence = ack;
+            started         = true;
+            oled_buffer_sync_reset();
+        } else if (ack == packet.sequence) {
+            pending = false;
+        } else if (ack == 0 && last_ack != 0) {
+            // The slave restarted, and lost its buffer
+            oled_buffer_sync_reset();
+        } else if (timer_elapsed32(last_update) < FORCED_SYNC_THROTTLE_MS) {
+            return true;
+        }
+        last_ack = ack;
+        if (idle_check) {
+            last_update = timer_read32();
+        }
+
+        if (pending) {
+            // Send the packet again, in case it didn't make it
+            last_update = timer_read32();
+            return transport_write(PUT_OLED_BUFFER, &packet, sizeof(packet));
+        }
+    }
+
+    if (budget < cost) {
+        return true;
+    }
+    packet.length = oled_buffer_sync_pack(&packet.offset, packet.data, sizeof(packet.data));
+    if (packet.length == 0) {
+        return true;
+    }
+    // Zero is what a slave that was just started acknowledges
+    if (++packet.sequence == 0) {
+        packet.sequence = 1;
+    }
+    budget -= cost;
+
+    pending     = true;
+    last_update = timer_read32();
+    return transport_write(PUT_OLED_BUFFER, &packet, sizeof(packet));
+}
+
+static void oled_buffer_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint8_t           last_sequence = 0;
+    split_oled_buffer_sync_t packet;
+
+    split_shared_memory_lock();
+    memcpy(&packet, &split_shmem->oled_buffer_sync, sizeof(packet));
+    split_shmem->oled_buffer_ack = packet.sequence;
+    split_shared_memory_unlock();
+
+    if (packet.sequence != last_sequence) {
+        last_sequence = packet.sequence;
+        oled_buffer_sync_unpack(packet.offset, packet.data, MIN(packet.length, sizeof(packet.data)));
+    }
+}
+
+// clang-format off
+#    define TRANSACTIONS_OLED_BUFFER_MASTER() TRANSACTION_HANDLER_MASTER(oled_buffer)
+#    define TRANSACTIONS_OLED_BUFFER_SLAVE() TRANSACTION_HANDLER_SLAVE(oled_buffer)
+#    define TRANSACTIONS_OLED_BUFFER_REGISTRATIONS \
+    [PUT_OLED_BUFFER]     = trans_initiator2target_initializer(oled_buffer_sync), \
+    [GET_OLED_BUFFER_ACK] = trans_target2initiator_initializer(oled_buffer_ack),
+// clang-format on
+
+#else // defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE)
+
+#    define TRANSACTIONS_OLED_BUFFER_MASTER()
+#    define TRANSACTIONS_OLED_BUFFER_SLAVE()
+#    define TRANSACTIONS_OLED_BUFFER_REGISTRATIONS
+
+#endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE)
+
 ////////////////////////////////////////////////////
 // ST7565
 
@@ -712,13 +1002,20 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
         return true;
     }
 #    endif
-    static uint32_t last_update     = 0;
-    static uint32_t last_cpi_update = 0;
-    static uint16_t last_cpi        = 0;
-    report_mouse_t  temp_state;
-    uint16_t        temp_cpi;
-    bool            okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
-    if (okay) pointing_device_set_shared_report(temp_state);
+    static uint32_t                        last_update     = 0;
+    static uint8_t                         last_checksum   = 0;
+    static uint32_t                        last_cpi_update = 0;
+    static uint16_t                        last_cpi        = 0;
+    static pointing_device_shared_motion_t last_state; // last successfully-read totals
+    uint16_t                               temp_cpi;
+    uint8_t                                prev_checksum = last_checksum;
+    // the slave may have restarted its running totals while the link was down
+    if (!is_transport_connected()) {
+        pointing_device_reset_shared_motion();
+    }
+    bool okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &last_checksum, &last_state, &split_shmem->pointing.report, sizeof(last_state));
+    // only hand over totals that were read and verified
+    if (okay && prev_checksum != last_checksum) pointing_device_set_shared_motion(&last_state);
     temp_cpi = pointing_device_get_shared_cpi();
     if (temp_cpi) {
         split_shmem->pointing.cpi = temp_cpi;
@@ -759,11 +1056,20 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 
     if (pointing.cpi && pointing.cpi != temp_cpi && pointing_device_driver->set_cpi) {
         pointing_device_driver->set_cpi(pointing.cpi);
+        temp_cpi = pointing.cpi;
     }
 
-    pointing.report = pointing_device_driver->get_report((report_mouse_t){0});
+    // Keep adding up sensor reads until the master picks them up, it only
+    // looks at the difference to the totals it read last time.
+    report_mouse_t report   = pointing_device_driver->get_report((report_mouse_t){0});
+    pointing.report.x       = pointing.report.x + (int16_t)report.x;
+    pointing.report.y       = pointing.report.y + (int16_t)report.y;
+    pointing.report.h       = pointing.report.h + (int16_t)report.h;
+    pointing.report.v       = pointing.report.v + (int16_t)report.v;
+    pointing.report.buttons = report.buttons;
+    pointing.report.cpi     = temp_cpi;
     // Now update the checksum given that the pointing has been written to
-    pointing.checksum = crc8(&pointing.report, sizeof(report_mouse_t));
+    pointing.checksum = crc8(&pointing.report, sizeof(pointing.report));
 
     split_shared_memory_lock();
     memcpy(&split_shmem->pointing, &pointing, sizeof(split_slave_pointing_sync_t));
@@ -935,6 +1241,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_RGB_MATRIX_REGISTRATIONS
     TRANSACTIONS_WPM_REGISTRATIONS
     TRANSACTIONS_OLED_REGISTRATIONS
+    TRANSACTIONS_OLED_BUFFER_REGISTRATIONS
     TRANSACTIONS_ST7565_REGISTRATIONS
     TRANSACTIONS_POINTING_REGISTRATIONS
     TRANSACTIONS_WATCHDOG_REGISTRATIONS
@@ -952,6 +1259,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 };
 
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_STATS_MASTER();
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
@@ -965,6 +1273,7 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_RGB_MATRIX_MASTER();
     TRANSACTIONS_WPM_MASTER();
     TRANSACTIONS_OLED_MASTER();
+    TRANSACTIONS_OLED_BUFFER_MASTER();
     TRANSACTIONS_ST7565_MASTER();
     TRANSACTIONS_POINTING_MASTER();
     TRANSACTIONS_WATCHDOG_MASTER();
@@ -988,6 +1297,7 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_RGB_MATRIX_SLAVE();
     TRANSACTIONS_WPM_SLAVE();
     TRANSACTIONS_OLED_SLAVE();
+    TRANSACTIONS_OLED_BUFFER_SLAVE();
     TRANSACTIONS_ST7565_SLAVE();
     TRANSACTIONS_POINTING_SLAVE();
     TRANSACTIONS_WATCHDOG_SLAVE();
@@ -20,6 +20,7 @@
 #include <stdbool.h>
 
 #include "matrix.h"
+#include "util.h"
 #include "transaction_id_define.h"
 #include "transport.h"
 
@@ -51,3 +52,35 @@ bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer
 
 #define transaction_rpc_send(transaction_id, initiator2target_buffer_size, initiator2target_buffer) transaction_rpc_exec(transaction_id, initiator2target_buffer_size, initiator2target_buffer, 0, NULL)
 #define transaction_rpc_recv(transaction_id, target2initiator_buffer_size, target2initiator_buffer) transaction_rpc_exec(transaction_id, 0, NULL, target2initiator_buffer_size, target2initiator_buffer)
+
+#ifdef SPLIT_TRANSACTION_STATS
+#    ifndef SPLIT_TRANSACTION_STATS_RAW_HID_ID
+#        define SPLIT_TRANSACTION_STATS_RAW_HID_ID 0xF0
+#    endif
+
+// Statistics of a single transaction ID, collected on the master
+typedef struct PACKED split_transaction_stats_t {
+    uint32_t attempts;
+    uint32_t failures;
+    uint32_t bytes;    // payload bytes the transport moved over the bus
+    uint32_t total_us; // duration of all attempts
+    uint16_t min_us;
+    uint16_t max_us;
+} split_transaction_stats_t;
+
+// Raw HID response, following the command and transaction ID bytes
+typedef struct PACKED split_transaction_stats_report_t {
+    uint8_t                   count; // number of transaction IDs
+    uint16_t                  cycles_per_second;
+    split_transaction_stats_t stats;
+} split_transaction_stats_report_t;
+
+const split_transaction_stats_t *split_transaction_stats_get(int8_t transaction_id);
+uint16_t                         split_transaction_stats_cycles_per_second(void);
+void                             split_transaction_stats_clear(void);
+void                             split_transaction_stats_print(void);
+
+// Handles a [SPLIT_TRANSACTION_STATS_RAW_HID_ID, transaction ID] request by
+// filling in the response, returns false if the packet is not a stats request
+bool split_transaction_stats_raw_hid(uint8_t *data, uint8_t length);
+#endif // SPLIT_TRANSACTION_STATS
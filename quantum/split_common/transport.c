@@ -23,6 +23,17 @@
 #include "transaction_id_define.h"
 #include "atomic_util.h"
 
+#ifdef SPLIT_TRANSACTION_STATS
+static uint32_t transferred_bytes;
+
+uint32_t transport_transferred_bytes(void) {
+    return transferred_bytes;
+}
+#    define TRANSPORT_COUNT_BYTES(count) (transferred_bytes += (count))
+#else // SPLIT_TRANSACTION_STATS
+#    define TRANSPORT_COUNT_BYTES(count)
+#endif // SPLIT_TRANSACTION_STATS
+
 #ifdef USE_I2C
 
 #    ifndef SLAVE_I2C_TIMEOUT
@@ -56,8 +67,12 @@ i2c_status_t transport_trigger_callback(int8_t id) {
 
     // Kick off the "callback executor", now that data has been written to the slave
     split_shmem->transaction_id     = id;
-    split_transaction_desc_t *trans = &split_transaction_table[I2C_EXECUTE_CALLBACK];
-    return i2c_write_register(SLAVE_I2C_ADDRESS, trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size, SLAVE_I2C_TIMEOUT);
+    split_transaction_desc_t *trans  = &split_transaction_table[I2C_EXECUTE_CALLBACK];
+    i2c_status_t              status = i2c_write_register(SLAVE_I2C_ADDRESS, trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size, SLAVE_I2C_TIMEOUT);
+    if (status >= 0) {
+        TRANSPORT_COUNT_BYTES(trans->initiator2target_buffer_size);
+    }
+    return status;
 }
 
 bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
@@ -65,10 +80,13 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
         size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
-        memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+        if (initiator2target_buf != split_trans_initiator2target_buffer(trans)) {
+            memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+        }
         if ((status = i2c_write_register(SLAVE_I2C_ADDRESS, trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), len, SLAVE_I2C_TIMEOUT)) < 0) {
             return false;
         }
+        TRANSPORT_COUNT_BYTES(len);
     }
 
     // If we need to execute a callback on the slave, do so
@@ -81,7 +99,10 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
         if ((status = i2c_read_register(SLAVE_I2C_ADDRESS, trans->target2initiator_offset, split_trans_target2initiator_buffer(trans), len, SLAVE_I2C_TIMEOUT)) < 0) {
             return false;
         }
-        memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+        TRANSPORT_COUNT_BYTES(len);
+        if (target2initiator_buf != split_trans_target2initiator_buffer(trans)) {
+            memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+        }
     }
 
     return true;
@@ -105,16 +126,22 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
         size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
-        memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+        if (initiator2target_buf != split_trans_initiator2target_buffer(trans)) {
+            memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+        }
     }
 
     if (!soft_serial_transaction(id)) {
         return false;
     }
+    // The serial protocols always exchange both buffers in full
+    TRANSPORT_COUNT_BYTES(trans->initiator2target_buffer_size + trans->target2initiator_buffer_size);
 
     if (target2initiator_length > 0) {
         size_t len = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
-        memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+        if (target2initiator_buf != split_trans_target2initiator_buffer(trans)) {
+            memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+        }
     }
 
     return true;
@@ -31,6 +31,10 @@
 #    define RPC_S2M_BUFFER_SIZE 32
 #endif // RPC_S2M_BUFFER_SIZE
 
+#ifndef SPLIT_OLED_BUFFER_PACKET_SIZE
+#    define SPLIT_OLED_BUFFER_PACKET_SIZE 32
+#endif // SPLIT_OLED_BUFFER_PACKET_SIZE
+
 void transport_master_init(void);
 void transport_slave_init(void);
 
@@ -38,8 +42,15 @@ void transport_slave_init(void);
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
+// Buffers that are the transaction's own region of split_shmem are used in
+// place, without being copied.
 bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
 
+#ifdef SPLIT_TRANSACTION_STATS
+// Running total of the payload bytes moved over the bus by the master
+uint32_t transport_transferred_bytes(void);
+#endif // SPLIT_TRANSACTION_STATS
+
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
 #endif // ENCODER_ENABLE
@@ -109,12 +120,21 @@ typedef struct _split_mods_sync_t {
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 #    include "pointing_device.h"
 typedef struct _split_slave_pointing_sync_t {
-    uint8_t        checksum;
-    report_mouse_t report;
-    uint16_t       cpi;
+    uint8_t                         checksum;
+    pointing_device_shared_motion_t report;
+    uint16_t                        cpi;
 } split_slave_pointing_sync_t;
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
+#if defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE)
+typedef struct _split_oled_buffer_sync_t {
+    uint8_t  sequence;
+    uint8_t  length;
+    uint16_t offset;
+    uint8_t  data[SPLIT_OLED_BUFFER_PACKET_SIZE];
+} split_oled_buffer_sync_t;
+#endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE)
+
 #if defined(HAPTIC_ENABLE) && defined(SPLIT_HAPTIC_ENABLE)
 #    include "haptic.h"
 typedef struct _split_slave_haptic_sync_t {
@@ -202,6 +222,11 @@ typedef struct _split_shared_memory_t {
     uint8_t current_oled_state;
 #endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_ENABLE)
 
+#if defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE)
+    split_oled_buffer_sync_t oled_buffer_sync;
+    uint8_t                  oled_buffer_ack;
+#endif // defined(OLED_ENABLE) && defined(SPLIT_OLED_BUFFER_ENABLE)
+
 #if defined(ST7565_ENABLE) && defined(SPLIT_ST7565_ENABLE)
     uint8_t current_st7565_state;
 #endif // ST7565_ENABLE(OLED_ENABLE) && defined(SPLIT_ST7565_ENABLE)
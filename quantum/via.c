@@ -49,6 +49,10 @@
 #    include "backlight.h"
 #endif
 
+#if defined(POINTING_DEVICE_TRANSFORM_ENABLE)
+#    include "pointing_device_transform.h"
+#endif
+
 #if defined(RGBLIGHT_ENABLE)
 #    include "rgblight.h"
 #endif
@@ -65,6 +69,10 @@
 #    include "led_matrix.h"
 #endif
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_STATS)
+#    include "transactions.h"
+#endif
+
 // Can be called in an overriding via_init_kb() to test if keyboard level code usage of
 // EEPROM is invalid and use/save defaults.
 bool via_eeprom_is_valid(void) {
@@ -227,11 +235,12 @@ __attribute__((weak)) void via_custom_value_command_kb(uint8_t *data, uint8_t le
 // This is the default handler for custom value commands.
 // It routes commands with channel IDs to command handlers as such:
 //
-//      id_qmk_backlight_channel    ->  via_qmk_backlight_command()
-//      id_qmk_rgblight_channel     ->  via_qmk_rgblight_command()
-//      id_qmk_rgb_matrix_channel   ->  via_qmk_rgb_matrix_command()
-//      id_qmk_led_matrix_channel   ->  via_qmk_led_matrix_command()
-//      id_qmk_audio_channel        ->  via_qmk_audio_command()
+//      id_qmk_backlight_channel       ->  via_qmk_backlight_command()
+//      id_qmk_rgblight_channel        ->  via_qmk_rgblight_command()
+//      id_qmk_rgb_matrix_channel      ->  via_qmk_rgb_matrix_command()
+//      id_qmk_led_matrix_channel      ->  via_qmk_led_matrix_command()
+//      id_qmk_audio_channel           ->  via_qmk_audio_command()
+//      id_qmk_pointing_device_channel ->  via_qmk_pointing_device_command()
 //
 __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t length) {
     // data = [ command_id, channel_id, value_id, value_data ]
@@ -272,6 +281,13 @@ __attribute__((weak)) void via_custom_value_command(uint8_t *data, uint8_t lengt
     }
 #endif // AUDIO_ENABLE
 
+#if defined(POINTING_DEVICE_TRANSFORM_ENABLE)
+    if (*channel_id == id_qmk_pointing_device_channel) {
+        via_qmk_pointing_device_command(data, length);
+        return;
+    }
+#endif // POINTING_DEVICE_TRANSFORM_ENABLE
+
     (void)channel_id; // force use of variable
 
     // If we haven't returned before here, then let the keyboard level code
@@ -291,6 +307,13 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
     uint8_t *command_id   = &(data[0]);
     uint8_t *command_data = &(data[1]);
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSACTION_STATS)
+    if (split_transaction_stats_raw_hid(data, length)) {
+        raw_hid_send(data, length);
+        return;
+    }
+#endif
+
     // If via_command_kb() returns true, the command was fully
     // handled, including calling raw_hid_send()
     if (via_command_kb(data, length)) {
@@ -885,3 +908,76 @@ void via_qmk_audio_save(void) {
 }
 
 #endif // QMK_AUDIO_ENABLE
+
+#if defined(POINTING_DEVICE_TRANSFORM_ENABLE)
+
+void via_qmk_pointing_device_command(uint8_t *data, uint8_t length) {
+    // data = [ command_id, channel_id, value_id, value_data ]
+    uint8_t *command_id        = &(data[0]);
+    uint8_t *value_id_and_data = &(data[2]);
+
+    switch (*command_id) {
+        case id_custom_set_value: {
+            via_qmk_pointing_device_set_value(value_id_and_data);
+            break;
+        }
+        case id_custom_get_value: {
+            via_qmk_pointing_device_get_value(value_id_and_data);
+            break;
+        }
+        case id_custom_save: {
+            via_qmk_pointing_device_save();
+            break;
+        }
+        default: {
+            *command_id = id_unhandled;
+            break;
+        }
+    }
+}
+
+void via_qmk_pointing_device_get_value(uint8_t *data) {
+    // data = [ value_id, value_data ]
+    uint8_t *value_id   = &(data[0]);
+    uint8_t *value_data = &(data[1]);
+    switch (*value_id) {
+        case id_qmk_pointing_device_sensitivity: {
+            value_data[0] = pointing_device_get_sensitivity();
+            break;
+        }
+        case id_qmk_pointing_device_acceleration: {
+            value_data[0] = pointing_device_get_acceleration();
+            break;
+        }
+        case id_qmk_pointing_device_scroll_divisor: {
+            value_data[0] = pointing_device_get_scroll_divisor();
+            break;
+        }
+    }
+}
+
+void via_qmk_pointing_device_set_value(uint8_t *data) {
+    // data = [ value_id, value_data ]
+    uint8_t *value_id   = &(data[0]);
+    uint8_t *value_data = &(data[1]);
+    switch (*value_id) {
+        case id_qmk_pointing_device_sensitivity: {
+            pointing_device_set_sensitivity_noeeprom(value_data[0]);
+            break;
+        }
+        case id_qmk_pointing_device_acceleration: {
+            pointing_device_set_acceleration_noeeprom(value_data[0]);
+            break;
+        }
+        case id_qmk_pointing_device_scroll_divisor: {
+            pointing_device_set_scroll_divisor_noeeprom(value_data[0]);
+            break;
+        }
+    }
+}
+
+void via_qmk_pointing_device_save(void) {
+    pointing_device_set_config(pointing_device_get_config());
+}
+
+#endif // POINTING_DEVICE_TRANSFORM_ENABLE
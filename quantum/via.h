@@ -85,12 +85,13 @@ enum via_keyboard_value_id {
 };
 
 enum via_channel_id {
-    id_custom_channel         = 0,
-    id_qmk_backlight_channel  = 1,
-    id_qmk_rgblight_channel   = 2,
-    id_qmk_rgb_matrix_channel = 3,
-    id_qmk_audio_channel      = 4,
-    id_qmk_led_matrix_channel = 5,
+    id_custom_channel              = 0,
+    id_qmk_backlight_channel       = 1,
+    id_qmk_rgblight_channel        = 2,
+    id_qmk_rgb_matrix_channel      = 3,
+    id_qmk_audio_channel           = 4,
+    id_qmk_led_matrix_channel      = 5,
+    id_qmk_pointing_device_channel = 6,
 };
 
 enum via_qmk_backlight_value {
@@ -123,6 +124,12 @@ enum via_qmk_audio_value {
     id_qmk_audio_clicky_enable = 2,
 };
 
+enum via_qmk_pointing_device_value {
+    id_qmk_pointing_device_sensitivity    = 1,
+    id_qmk_pointing_device_acceleration   = 2,
+    id_qmk_pointing_device_scroll_divisor = 3,
+};
+
 // Can be called in an overriding via_init_kb() to test if keyboard level code usage of
 // EEPROM is invalid and use/save defaults.
 bool via_eeprom_is_valid(void);
@@ -188,3 +195,10 @@ void via_qmk_audio_set_value(uint8_t *data);
 void via_qmk_audio_get_value(uint8_t *data);
 void via_qmk_audio_save(void);
 #endif
+
+#if defined(POINTING_DEVICE_TRANSFORM_ENABLE)
+void via_qmk_pointing_device_command(uint8_t *data, uint8_t length);
+void via_qmk_pointing_device_set_value(uint8_t *data);
+void via_qmk_pointing_device_get_value(uint8_t *data);
+void via_qmk_pointing_device_save(void);
+#endif
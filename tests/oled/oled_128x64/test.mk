@@ -0,0 +1,8 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+OLED_ENABLE = yes
+OLED_TRANSPORT = custom
+
+# The same tests, with a different display configuration
+SRC += tests/oled/test_oled.cpp
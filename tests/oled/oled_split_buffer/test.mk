@@ -0,0 +1,8 @@
+# Copyright 2025 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+OLED_ENABLE = yes
+OLED_TRANSPORT = custom
+
+# The display tests still apply, and provide the emulated display
+SRC += tests/oled/test_oled.cpp
@@ -0,0 +1,176 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "oled_driver.h"
+}
+
+/* Draws the other half's display, run by oled_task() while the remote buffer is selected */
+static std::function<void()> draw;
+/* The other half's buffer on the master, as last drawn */
+static std::vector<uint8_t> remote(OLED_MATRIX_SIZE);
+
+extern "C" bool oled_task_user(void) {
+    if (is_oled_remote() && draw) {
+        draw();
+        auto reader = oled_read_raw(0);
+        remote.assign(reader.current_element, reader.current_element + OLED_MATRIX_SIZE);
+    }
+    return false;
+}
+
+/* The master packs changes to the other half's buffer, and this half's own buffer stands in for the slave's */
+class OledSplitBuffer : public ::testing::Test {
+   protected:
+    std::mt19937 rng{5678};
+
+    void SetUp() override {
+        ASSERT_TRUE(oled_init(OLED_ROTATION_0));
+        draw_remote([] { oled_clear(); });
+        oled_buffer_sync_reset();
+        sync_all(255);
+        expect_slave_matches();
+    }
+
+    void TearDown() override {
+        draw = nullptr;
+    }
+
+    static void draw_remote(std::function<void()> drawing) {
+        draw = drawing;
+        oled_task();
+        draw = nullptr;
+    }
+
+    void draw_random_bytes(uint16_t start, uint16_t end) {
+        std::vector<char> data(end - start);
+        for (auto &byte : data) {
+            byte = rng();
+        }
+        draw_remote([&] {
+            for (uint16_t i = start; i < end; i++) {
+                oled_write_raw_byte(data[i - start], i);
+            }
+        });
+    }
+
+    /* Sends one packet of at most size bytes, returning false if there was nothing to send */
+    static bool sync_one(uint8_t size) {
+        uint8_t  data[255];
+        uint16_t offset = 0;
+        uint8_t  length = oled_buffer_sync_pack(&offset, data, size);
+        EXPECT_LE(length, size);
+        if (length == 0) {
+            return false;
+        }
+        oled_buffer_sync_unpack(offset, data, length);
+        return true;
+    }
+
+    static void sync_all(uint8_t size) {
+        for (int i = 0; sync_one(size); ++i) {
+            ASSERT_LT(i, OLED_MATRIX_SIZE) << "still sending";
+        }
+    }
+
+    static void expect_slave_matches() {
+        auto reader = oled_read_raw(0);
+        for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i++) {
+            ASSERT_EQ(reader.current_element[i], remote[i]) << "at byte " << i;
+        }
+    }
+
+    /* The slave restarted, and its buffer is blank */
+    static void slave_restarts() {
+        oled_clear();
+        oled_buffer_sync_reset();
+    }
+};
+
+TEST_F(OledSplitBuffer, OnlyChangesAreSent) {
+    draw_remote([] { oled_write_pixel(5, 5, true); });
+    uint8_t  data[255];
+    uint16_t offset = 0;
+    EXPECT_EQ(oled_buffer_sync_pack(&offset, data, sizeof(data)), 2);
+    EXPECT_EQ(offset, 5);
+    oled_buffer_sync_unpack(offset, data, 2);
+    expect_slave_matches();
+    EXPECT_EQ(oled_buffer_sync_pack(&offset, data, sizeof(data)), 0);
+}
+
+TEST_F(OledSplitBuffer, SmallPacketsRoundTrip) {
+    for (uint8_t size : {2, 3, 4, 7, 32, 255}) {
+        draw_random_bytes(0, OLED_MATRIX_SIZE);
+        draw_remote([] { oled_write_ln("repeated runs", false); });
+        sync_all(size);
+        expect_slave_matches();
+    }
+}
+
+TEST_F(OledSplitBuffer, ResetResendsEverything) {
+    draw_random_bytes(0, OLED_MATRIX_SIZE);
+    sync_all(32);
+    expect_slave_matches();
+
+    slave_restarts();
+    sync_all(32);
+    expect_slave_matches();
+}
+
+TEST_F(OledSplitBuffer, ComplementDrawnDuringResync) {
+    draw_random_bytes(0, OLED_MATRIX_SIZE);
+    sync_all(32);
+
+    // Only part of the buffer has been resent when half of it changes to the complement of what it was at the reset
+    slave_restarts();
+    sync_one(32);
+    sync_one(32);
+    std::vector<uint8_t> drawn = remote;
+    draw_remote([&] {
+        for (uint16_t i = OLED_MATRIX_SIZE / 2; i < OLED_MATRIX_SIZE; i++) {
+            oled_write_raw_byte(~drawn[i], i);
+        }
+    });
+
+    sync_all(32);
+    expect_slave_matches();
+}
+
+TEST_F(OledSplitBuffer, DrawingDuringResync) {
+    for (int round = 0; round < 20; ++round) {
+        slave_restarts();
+        for (int step = 0; step < 40; ++step) {
+            switch (rng() % 4) {
+                case 0:
+                    draw_remote([&] { oled_write_pixel(rng() % OLED_DISPLAY_WIDTH, rng() % OLED_DISPLAY_HEIGHT, rng() & 1); });
+                    break;
+                case 1: {
+                    uint16_t start = rng() % OLED_MATRIX_SIZE;
+                    draw_random_bytes(start, start + (rng() % (OLED_MATRIX_SIZE - start)));
+                    break;
+                }
+                case 2: {
+                    std::vector<uint8_t> drawn = remote;
+                    draw_remote([&] {
+                        for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i += 1 + rng() % 3) {
+                            oled_write_raw_byte(~drawn[i], i);
+                        }
+                    });
+                    break;
+                }
+                default:
+                    draw_remote([&] { oled_write(round & 1 ? "0123" : "    ", false); });
+                    break;
+            }
+            sync_one(2 + rng() % 40);
+        }
+        sync_all(2 + rng() % 40);
+        expect_slave_matches();
+    }
+}
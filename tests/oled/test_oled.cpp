@@ -0,0 +1,204 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "oled_driver.h"
+}
+
+static const uint16_t PAGES = OLED_DISPLAY_HEIGHT / 8;
+
+/* An SSD1306 in horizontal addressing mode, which is all the render path uses */
+namespace display {
+
+static uint8_t  memory[OLED_MATRIX_SIZE];
+static uint8_t  column_start, column_end, page_start, page_end;
+static uint8_t  column, page;
+static uint32_t bytes_sent;
+static uint16_t largest_transfer;
+
+static void reset(uint8_t fill) {
+    std::memset(memory, fill, sizeof(memory));
+    column_start = column = page_start = page = 0;
+    column_end                                 = OLED_DISPLAY_WIDTH - 1;
+    page_end                                   = PAGES - 1;
+    bytes_sent = largest_transfer = 0;
+}
+
+} // namespace display
+
+extern "C" {
+
+void oled_driver_init(void) {}
+
+bool oled_send_cmd(const uint8_t *data, uint16_t size) {
+    // The render path sets the column and page range in one command: I2C_CMD, COLUMN_ADDR, start, end, PAGE_ADDR, start, end
+    if (size == 7 && data[1] == 0x21 && data[4] == 0x22) {
+        display::column = display::column_start = data[2];
+        display::column_end                     = data[3];
+        display::page = display::page_start = data[5];
+        display::page_end                   = data[6];
+    }
+    return true;
+}
+
+bool oled_send_data(const uint8_t *data, uint16_t size) {
+    for (uint16_t i = 0; i < size; ++i) {
+        display::memory[display::page * OLED_DISPLAY_WIDTH + display::column] = data[i];
+        if (display::column++ == display::column_end) {
+            display::column = display::column_start;
+            if (display::page++ == display::page_end) {
+                display::page = display::page_start;
+            }
+        }
+    }
+    display::bytes_sent += size;
+    display::largest_transfer = std::max(display::largest_transfer, size);
+    return true;
+}
+
+} // extern "C"
+
+class Oled : public ::testing::TestWithParam<oled_rotation_t> {
+   protected:
+    std::mt19937 rng{1234};
+
+    void SetUp() override {
+        // Anything not rendered shows up as a mismatch
+        display::reset(0xA5);
+        ASSERT_TRUE(oled_init(GetParam()));
+        render_all();
+        expect_display_matches();
+        display::bytes_sent = display::largest_transfer = 0;
+    }
+
+    bool rotated() const {
+        return GetParam() & OLED_ROTATION_90;
+    }
+
+    /* Renders the configured number of transfers at a time, like oled_task() does */
+    static void render_all() {
+        for (int i = 0; oled_is_dirty(); ++i) {
+            ASSERT_LT(i, OLED_MATRIX_SIZE) << "still dirty after rendering";
+            oled_render();
+        }
+    }
+
+    /* The display memory the buffer should end up as, with 90 degree rotation done one pixel at a time */
+    std::vector<uint8_t> expected_display() const {
+        const uint8_t *buffer = oled_read_raw(0).current_element;
+        if (!rotated()) {
+            return std::vector<uint8_t>(buffer, buffer + OLED_MATRIX_SIZE);
+        }
+        std::vector<uint8_t> memory(OLED_MATRIX_SIZE);
+        for (uint16_t column = 0; column < OLED_DISPLAY_WIDTH; ++column) {
+            for (uint16_t row = 0; row < OLED_DISPLAY_HEIGHT; ++row) {
+                // The buffer is laid out as a display of OLED_DISPLAY_HEIGHT by OLED_DISPLAY_WIDTH pixels
+                uint16_t x = OLED_DISPLAY_HEIGHT - 1 - row;
+                uint16_t y = column;
+                if (buffer[y / 8 * OLED_DISPLAY_HEIGHT + x] & (1 << (y % 8))) {
+                    memory[row / 8 * OLED_DISPLAY_WIDTH + column] |= 1 << (row % 8);
+                }
+            }
+        }
+        return memory;
+    }
+
+    void expect_display_matches() const {
+        auto expected = expected_display();
+        for (uint16_t i = 0; i < OLED_MATRIX_SIZE; ++i) {
+            ASSERT_EQ(display::memory[i], expected[i]) << "at page " << i / OLED_DISPLAY_WIDTH << ", column " << i % OLED_DISPLAY_WIDTH;
+        }
+    }
+
+    /* Width and height of the buffer as drawn to, which swap when rotated */
+    uint16_t width() const {
+        return rotated() ? OLED_DISPLAY_HEIGHT : OLED_DISPLAY_WIDTH;
+    }
+    uint16_t height() const {
+        return rotated() ? OLED_DISPLAY_WIDTH : OLED_DISPLAY_HEIGHT;
+    }
+};
+
+TEST_P(Oled, RawBufferIsRendered) {
+    std::vector<char> data(OLED_MATRIX_SIZE);
+    for (auto &byte : data) {
+        byte = rng();
+    }
+    oled_set_cursor(0, 0);
+    oled_write_raw(data.data(), data.size());
+
+    render_all();
+    expect_display_matches();
+    EXPECT_LE(display::largest_transfer, OLED_UPDATE_CHUNK_SIZE);
+}
+
+TEST_P(Oled, SinglePixelSendsOneByte) {
+    oled_write_pixel(width() / 2 + 3, height() / 2 + 5, true);
+    EXPECT_TRUE(oled_is_dirty());
+
+    render_all();
+    expect_display_matches();
+    // Rotated, a byte of the buffer covers one bit of 8 columns
+    EXPECT_EQ(display::bytes_sent, rotated() ? 8u : 1u);
+}
+
+TEST_P(Oled, UnchangedWritesAreNotRendered) {
+    oled_write_pixel(1, 1, false);
+    oled_write_raw_byte(0, 7);
+    EXPECT_FALSE(oled_is_dirty());
+
+    oled_write_raw_byte((char)0xC3, 7);
+    render_all();
+    oled_write_raw_byte((char)0xC3, 7);
+    EXPECT_FALSE(oled_is_dirty());
+}
+
+TEST_P(Oled, SpansInOnePageAreMerged) {
+    oled_write_pixel(0, 0, true);
+    oled_write_pixel(20, 0, true);
+    oled_write_pixel(10, 0, true);
+
+    render_all();
+    expect_display_matches();
+    // Rotated, the three bytes end up in separate pages
+    EXPECT_EQ(display::bytes_sent, rotated() ? 3u * 8 : 21u);
+}
+
+TEST_P(Oled, DrawingWhileRendering) {
+    for (int round = 0; round < 200; ++round) {
+        // A few scattered pixels and bytes, then only part of it gets rendered before more drawing happens
+        for (int i = 0; i < 6; ++i) {
+            oled_write_pixel(rng() % width(), rng() % height(), rng() & 1);
+        }
+        oled_write_raw_byte(rng(), rng() % OLED_MATRIX_SIZE);
+        if (round % 3 == 0) {
+            oled_set_cursor(rng() % oled_max_chars(), rng() % oled_max_lines());
+            oled_write("QMK", round & 1);
+        }
+        oled_render();
+
+        if (round % 50 == 49) {
+            render_all();
+            expect_display_matches();
+        }
+    }
+    EXPECT_LE(display::largest_transfer, OLED_UPDATE_CHUNK_SIZE);
+}
+
+TEST_P(Oled, ClearIsRendered) {
+    oled_write_ln("Hello", false);
+    render_all();
+    oled_clear();
+    render_all();
+    expect_display_matches();
+    EXPECT_EQ(std::count(display::memory, display::memory + OLED_MATRIX_SIZE, 0), OLED_MATRIX_SIZE);
+}
+
+INSTANTIATE_TEST_CASE_P(Rotation, Oled, ::testing::Values(OLED_ROTATION_0, OLED_ROTATION_90));
@@ -0,0 +1,15 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define QUANTUM_PAINTER_SUPPORTS_256_PALETTE 1
+#define QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS 1
+#define QUANTUM_PAINTER_ASYNC_COMMS 1
+#define QUANTUM_PAINTER_TEXT_BUFFER_SIZE 32
+#define SURFACE_NUM_DEVICES 2
+#define QUANTUM_PAINTER_FLASH_CACHE_LINE_SIZE 64
+#define QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS 0x1000
+#define QUANTUM_PAINTER_FLASH_SHARES_BUS 1
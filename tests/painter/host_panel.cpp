@@ -0,0 +1,134 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "host_panel.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace host {
+
+panel_t::panel_t(uint16_t width, uint16_t height) : w(width), h(height), framebuffer(width * height) {
+    std::memset(&driver.surface, 0, sizeof(driver.surface));
+    driver.owner = this;
+    qp_make_rgb888_surface_advanced(&driver.surface, 1, width, height, framebuffer.data());
+
+    // Count the traffic on the way through to the surface
+    surface_vtable                    = driver.surface.base.driver_vtable;
+    vtable                            = *(const surface_painter_driver_vtable_t*)surface_vtable;
+    vtable.base.viewport              = viewport;
+    vtable.base.pixdata               = pixdata;
+    driver.surface.base.driver_vtable = &vtable.base;
+}
+
+bool panel_t::viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    panel_t* panel = ((driver_t*)device)->owner;
+    panel->stats.viewports++;
+    panel->stats.bytes += VIEWPORT_BYTES;
+    return panel->surface_vtable->viewport(device, left, top, right, bottom);
+}
+
+bool panel_t::pixdata(painter_device_t device, const void* pixel_data, uint32_t native_pixel_count) {
+    panel_t* panel = ((driver_t*)device)->owner;
+    panel->stats.pixels += native_pixel_count;
+    panel->stats.bytes += native_pixel_count * sizeof(rgb_t);
+    return panel->surface_vtable->pixdata(device, pixel_data, native_pixel_count);
+}
+
+bool panel_t::write_ppm(const std::string& path) const {
+    FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) {
+        return false;
+    }
+    std::fprintf(f, "P6\n%d %d\n255\n", w, h);
+    bool ok = std::fwrite(framebuffer.data(), sizeof(rgb_t), framebuffer.size(), f) == framebuffer.size();
+    return std::fclose(f) == 0 && ok;
+}
+
+static uint32_t crc32(const uint8_t* data, size_t length, uint32_t crc = 0) {
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+static void put32be(std::vector<uint8_t>& out, uint32_t value) {
+    for (int i = 3; i >= 0; i--) {
+        out.push_back((value >> (8 * i)) & 0xFF);
+    }
+}
+
+static void put_chunk(std::vector<uint8_t>& out, const char* type, const std::vector<uint8_t>& data) {
+    put32be(out, data.size());
+    size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    put32be(out, crc32(&out[start], out.size() - start));
+}
+
+/* Writes an RGB PNG, using uncompressed deflate blocks so no zlib is needed */
+bool panel_t::write_png(const std::string& path) const {
+    std::vector<uint8_t> raw;
+    for (uint16_t y = 0; y < h; y++) {
+        raw.push_back(0); // no filter
+        const uint8_t* row = (const uint8_t*)&framebuffer[y * w];
+        raw.insert(raw.end(), row, row + w * sizeof(rgb_t));
+    }
+
+    std::vector<uint8_t> zlib = {0x78, 0x01};
+    uint32_t             a = 1, b = 0;
+    for (size_t pos = 0; pos < raw.size() || pos == 0; pos += 0xFFFF) {
+        uint16_t length = raw.size() - pos < 0xFFFF ? raw.size() - pos : 0xFFFF;
+        zlib.push_back(pos + length == raw.size() ? 1 : 0);
+        zlib.push_back(length & 0xFF);
+        zlib.push_back(length >> 8);
+        zlib.push_back(~length & 0xFF);
+        zlib.push_back((~length >> 8) & 0xFF);
+        zlib.insert(zlib.end(), raw.begin() + pos, raw.begin() + pos + length);
+    }
+    for (uint8_t byte : raw) {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    put32be(zlib, (b << 16) | a);
+
+    std::vector<uint8_t> header;
+    put32be(header, w);
+    put32be(header, h);
+    header.insert(header.end(), {8, 2, 0, 0, 0}); // 8 bits per channel, RGB
+
+    std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    put_chunk(png, "IHDR", header);
+    put_chunk(png, "IDAT", zlib);
+    put_chunk(png, "IEND", {});
+
+    FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) {
+        return false;
+    }
+    bool ok = std::fwrite(png.data(), 1, png.size(), f) == png.size();
+    return std::fclose(f) == 0 && ok;
+}
+
+bool read_ppm(const std::string& path, uint16_t& width, uint16_t& height, std::vector<rgb_t>& pixels) {
+    FILE* f = std::fopen(path.c_str(), "rb");
+    if (!f) {
+        return false;
+    }
+    int  w, h, max;
+    bool ok = std::fscanf(f, "P6 %d %d %d", &w, &h, &max) == 3 && max == 255 && std::fgetc(f) != EOF;
+    if (ok) {
+        width  = w;
+        height = h;
+        pixels.resize(w * h);
+        ok = std::fread(pixels.data(), sizeof(rgb_t), pixels.size(), f) == pixels.size();
+    }
+    std::fclose(f);
+    return ok;
+}
+
+} // namespace host
@@ -0,0 +1,74 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "color.h"
+#include "qp_internal.h"
+#include "qp_surface_internal.h"
+}
+
+/* A panel rendering into an RGB888 framebuffer on the host, using the RGB888 surface driver. It keeps count of what a
+ * real SPI panel would be sent, so drawing routines can be compared by the comms traffic they cause as well. */
+namespace host {
+
+/* Column address set, row address set and memory write commands, as sent by the ILI9xxx/ST77xx drivers */
+static const uint32_t VIEWPORT_BYTES = (1 + 4) + (1 + 4) + 1;
+
+struct stats_t {
+    uint32_t viewports = 0;
+    uint64_t pixels    = 0;
+    /* Bytes sent over the bus: the column/row address and memory write commands of every viewport, plus 3 bytes per pixel */
+    uint64_t bytes = 0;
+};
+
+class panel_t {
+   public:
+    panel_t(uint16_t width, uint16_t height);
+    panel_t(const panel_t&) = delete;
+    panel_t& operator=(const panel_t&) = delete;
+
+    painter_device_t device() {
+        return &driver.surface;
+    }
+    uint16_t width() const {
+        return w;
+    }
+    uint16_t height() const {
+        return h;
+    }
+    const std::vector<rgb_t>& pixels() const {
+        return framebuffer;
+    }
+
+    stats_t stats;
+
+    bool write_ppm(const std::string& path) const;
+    bool write_png(const std::string& path) const;
+
+   private:
+    /* The surface comes first, so the device handle can be cast back to the panel that owns it */
+    struct driver_t {
+        surface_painter_device_t surface;
+        panel_t*                 owner;
+    } driver;
+
+    const painter_driver_vtable_t*  surface_vtable;
+    surface_painter_driver_vtable_t vtable;
+    uint16_t                        w;
+    uint16_t                        h;
+    std::vector<rgb_t>              framebuffer;
+
+    static bool viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
+    static bool pixdata(painter_device_t device, const void* pixel_data, uint32_t native_pixel_count);
+};
+
+/* Reads a binary (P6) PPM file, as written by panel_t::write_ppm */
+bool read_ppm(const std::string& path, uint16_t& width, uint16_t& height, std::vector<rgb_t>& pixels);
+
+} // namespace host
@@ -0,0 +1,37 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "mock_flash.hpp"
+#include "mock_panel.hpp"
+
+#include <cstring>
+
+extern "C" {
+#include "flash.h"
+}
+
+namespace mock {
+
+std::vector<uint8_t> flash;
+int                  flash_reads;
+uint64_t             flash_bytes_read;
+int                  flash_reads_on_held_bus;
+
+void reset_flash() {
+    flash_reads             = 0;
+    flash_bytes_read        = 0;
+    flash_reads_on_held_bus = 0;
+}
+
+} // namespace mock
+
+extern "C" flash_status_t flash_read_range(uint32_t addr, void* buf, size_t len) {
+    if (addr + len > mock::flash.size()) {
+        return FLASH_STATUS_BAD_ADDRESS;
+    }
+    mock::flash_reads++;
+    mock::flash_bytes_read += len;
+    mock::flash_reads_on_held_bus += mock::started != mock::stopped || mock::in_flight_data != nullptr;
+    std::memcpy(buf, &mock::flash[addr], len);
+    return FLASH_STATUS_SUCCESS;
+}
@@ -0,0 +1,20 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/* External flash for FLASH_DRIVER = custom, backed by a vector and counting how it's read */
+namespace mock {
+
+extern std::vector<uint8_t> flash;
+extern int                  flash_reads;
+extern uint64_t             flash_bytes_read;
+/* Number of reads made while the mock panel had the bus, which would fail if they shared it */
+extern int flash_reads_on_held_bus;
+
+void reset_flash();
+
+} // namespace mock
@@ -0,0 +1,153 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "mock_panel.hpp"
+
+extern "C" {
+#include "color.h"
+#include "qp_comms.h"
+}
+
+namespace mock {
+
+std::vector<transfer_t> transfers;
+const uint8_t*          in_flight_data;
+int                     started;
+int                     stopped;
+int                     overlapped;
+
+static uint32_t in_flight_length;
+static int      polls_until_done;
+static bool     other_device_active;
+
+void reset() {
+    transfers.clear();
+    in_flight_data = nullptr;
+    started = stopped = overlapped = 0;
+    other_device_active             = false;
+}
+
+bool other_device_start() {
+    if (started != stopped || in_flight_data != nullptr) {
+        return false;
+    }
+    other_device_active = true;
+    return true;
+}
+
+void other_device_stop() {
+    other_device_active = false;
+}
+
+static bool comms_init(painter_device_t device) {
+    return true;
+}
+
+static bool comms_start(painter_device_t device) {
+    overlapped += in_flight_data != nullptr || other_device_active;
+    started++;
+    return true;
+}
+
+static bool comms_stop(painter_device_t device) {
+    overlapped += in_flight_data != nullptr;
+    stopped++;
+    return true;
+}
+
+static uint32_t comms_send(painter_device_t device, const void* data, uint32_t byte_count) {
+    overlapped += in_flight_data != nullptr;
+    transfers.push_back({false, std::vector<uint8_t>((const uint8_t*)data, (const uint8_t*)data + byte_count)});
+    return byte_count;
+}
+
+static uint32_t comms_send_async(painter_device_t device, const void* data, uint32_t byte_count) {
+    overlapped += in_flight_data != nullptr;
+    in_flight_data   = (const uint8_t*)data;
+    in_flight_length = byte_count;
+    polls_until_done = 3;
+    return byte_count;
+}
+
+static bool comms_busy(painter_device_t device) {
+    if (in_flight_data == nullptr) {
+        return false;
+    }
+    if (--polls_until_done > 0) {
+        return true;
+    }
+    transfers.push_back({true, std::vector<uint8_t>(in_flight_data, in_flight_data + in_flight_length)});
+    in_flight_data = nullptr;
+    return false;
+}
+
+static bool init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+
+static bool power(painter_device_t device, bool power_on) {
+    return true;
+}
+
+static bool clear(painter_device_t device) {
+    return true;
+}
+
+static bool flush(painter_device_t device) {
+    return true;
+}
+
+static bool viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    uint16_t window[4] = {left, top, right, bottom};
+    qp_comms_send(device, window, sizeof(window));
+    return true;
+}
+
+static bool pixdata(painter_device_t device, const void* pixel_data, uint32_t native_pixel_count) {
+    qp_comms_send_async(device, pixel_data, native_pixel_count * sizeof(uint16_t));
+    return true;
+}
+
+bool palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t* palette) {
+    for (int16_t i = 0; i < palette_size; ++i) {
+        rgb_t rgb         = hsv_to_rgb_nocie(palette[i].hsv888);
+        palette[i].rgb565 = (((uint16_t)rgb.r) >> 3) << 11 | (((uint16_t)rgb.g) >> 2) << 5 | (((uint16_t)rgb.b) >> 3);
+    }
+    return true;
+}
+
+static bool append_pixels(painter_device_t device, uint8_t* target_buffer, qp_pixel_t* palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t* palette_indices) {
+    uint16_t* buf = (uint16_t*)target_buffer;
+    for (uint32_t i = 0; i < pixel_count; ++i) {
+        buf[pixel_offset + i] = palette[palette_indices[i]].rgb565;
+    }
+    return true;
+}
+
+static bool append_pixdata(painter_device_t device, uint8_t* target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    target_buffer[pixdata_offset] = pixdata_byte;
+    return true;
+}
+
+const painter_driver_vtable_t driver_vtable = {
+    .init            = init,
+    .power           = power,
+    .clear           = clear,
+    .flush           = flush,
+    .viewport        = viewport,
+    .pixdata         = pixdata,
+    .palette_convert = palette_convert,
+    .append_pixels   = append_pixels,
+    .append_pixdata  = append_pixdata,
+};
+
+const painter_comms_vtable_t comms_vtable = {
+    .comms_init       = comms_init,
+    .comms_start      = comms_start,
+    .comms_stop       = comms_stop,
+    .comms_send       = comms_send,
+    .comms_send_async = comms_send_async,
+    .comms_busy       = comms_busy,
+};
+
+} // namespace mock
@@ -0,0 +1,39 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+extern "C" {
+#include "qp_internal.h"
+}
+
+/* An RGB565 panel whose comms behave like a DMA transfer: data handed to comms_send_async is only read when the
+ * transfer completes, a few polls later, so anything overwriting it too early shows up in the received data. */
+namespace mock {
+
+struct transfer_t {
+    bool                 async;
+    std::vector<uint8_t> data;
+};
+
+/* Everything sent to the panel, with viewports sent synchronously as four uint16_t */
+extern std::vector<transfer_t> transfers;
+extern const uint8_t*          in_flight_data;
+extern int                     started;
+extern int                     stopped;
+/* Number of comms calls made while a transfer was still in flight, or while another device had the bus */
+extern int overlapped;
+
+void reset();
+/* Another device on the same bus, such as a pointing device sensor -- it can only start once the panel has stopped */
+bool other_device_start();
+void other_device_stop();
+bool palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t* palette);
+
+extern const painter_driver_vtable_t driver_vtable;
+extern const painter_comms_vtable_t  comms_vtable;
+
+} // namespace mock
@@ -0,0 +1,214 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "qgf_builder.hpp"
+
+#include <algorithm>
+
+static void put8(std::vector<uint8_t>& out, uint8_t value) {
+    out.push_back(value);
+}
+
+static void put16(std::vector<uint8_t>& out, uint16_t value) {
+    put8(out, value & 0xFF);
+    put8(out, value >> 8);
+}
+
+static void put24(std::vector<uint8_t>& out, uint32_t value) {
+    put16(out, value & 0xFFFF);
+    put8(out, (value >> 16) & 0xFF);
+}
+
+static void put32(std::vector<uint8_t>& out, uint32_t value) {
+    put16(out, value & 0xFFFF);
+    put16(out, value >> 16);
+}
+
+static void put_header(std::vector<uint8_t>& out, uint8_t type_id, uint32_t length) {
+    put8(out, type_id);
+    put8(out, ~type_id);
+    put24(out, length);
+}
+
+std::vector<uint8_t> qgf_pack_pixels(const std::vector<uint8_t>& indices, uint8_t bpp) {
+    const uint8_t        pixels_per_byte = 8 / bpp;
+    std::vector<uint8_t> out((indices.size() + pixels_per_byte - 1) / pixels_per_byte, 0);
+    for (size_t i = 0; i < indices.size(); i++) {
+        out[i / pixels_per_byte] |= (indices[i] & ((1 << bpp) - 1)) << ((i % pixels_per_byte) * bpp);
+    }
+    return out;
+}
+
+std::vector<uint8_t> qgf_compress_rle(const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> out;
+    size_t               i = 0;
+    while (i < data.size()) {
+        // Repeated run of up to 127 bytes
+        size_t run = 1;
+        while (i + run < data.size() && run < 127 && data[i + run] == data[i]) {
+            run++;
+        }
+        if (run >= 2) {
+            put8(out, run);
+            put8(out, data[i]);
+            i += run;
+            continue;
+        }
+
+        // Literal run of up to 128 bytes, stopping before the next repeat
+        size_t start = i;
+        while (i < data.size() && (i - start) < 128 && !(i + 1 < data.size() && data[i + 1] == data[i])) {
+            i++;
+        }
+        put8(out, 127 + (i - start));
+        out.insert(out.end(), data.begin() + start, data.begin() + i);
+    }
+    return out;
+}
+
+std::vector<uint8_t> qgf_build_image(uint16_t width, uint16_t height, qp_image_format_t format, painter_compression_t compression, const std::vector<uint8_t>& data) {
+    qgf_frame_t frame;
+    frame.data = data;
+    return qgf_build_animation(width, height, format, compression, {frame});
+}
+
+std::vector<uint8_t> qgf_build_animation(uint16_t width, uint16_t height, qp_image_format_t format, painter_compression_t compression, const std::vector<qgf_frame_t>& frames) {
+    std::vector<uint8_t> out;
+
+    // Graphics descriptor, the file size is patched in at the end
+    put_header(out, 0x00, 18);
+    put24(out, 0x464751);
+    put8(out, 0x01);
+    put32(out, 0);
+    put32(out, 0);
+    put16(out, width);
+    put16(out, height);
+    put16(out, frames.size());
+
+    // Frame offsets, patched in as each frame is written
+    put_header(out, 0x01, frames.size() * sizeof(uint32_t));
+    size_t offsets = out.size();
+    out.resize(out.size() + frames.size() * sizeof(uint32_t));
+
+    for (size_t f = 0; f < frames.size(); f++) {
+        const qgf_frame_t& frame = frames[f];
+        for (int i = 0; i < 4; i++) {
+            out[offsets + f * sizeof(uint32_t) + i] = (out.size() >> (8 * i)) & 0xFF;
+        }
+
+        // Frame descriptor
+        put_header(out, 0x02, 6);
+        put8(out, format);
+        put8(out, frame.delta ? 0x02 : 0);
+        put8(out, compression);
+        put8(out, 0xFF);
+        put16(out, frame.delay);
+
+        // Delta descriptor
+        if (frame.delta) {
+            put_header(out, 0x04, 8);
+            put16(out, frame.left);
+            put16(out, frame.top);
+            put16(out, frame.right);
+            put16(out, frame.bottom);
+        }
+
+        // Frame data
+        put_header(out, 0x05, frame.data.size());
+        out.insert(out.end(), frame.data.begin(), frame.data.end());
+    }
+
+    uint32_t total = out.size();
+    for (int i = 0; i < 4; i++) {
+        out[9 + i]  = (total >> (8 * i)) & 0xFF;
+        out[13 + i] = (~total >> (8 * i)) & 0xFF;
+    }
+    return out;
+}
+
+std::vector<uint8_t> qff_build_font(uint8_t line_height, qp_image_format_t format, painter_compression_t compression, const std::vector<qff_glyph_t>& glyphs) {
+    std::vector<uint8_t>                       out;
+    std::vector<uint8_t>                       data;
+    std::vector<uint32_t>                      ascii(95, 0);
+    std::vector<std::pair<uint32_t, uint32_t>> unicode;
+
+    // Glyph data is compressed separately for each glyph, as the decoder starts afresh at every glyph
+    for (const qff_glyph_t& glyph : glyphs) {
+        uint32_t value = glyph.width | (data.size() << 6);
+        auto     bytes = qgf_pack_pixels(glyph.indices, 1 << format);
+        if (compression == IMAGE_COMPRESSED_RLE) {
+            bytes = qgf_compress_rle(bytes);
+        }
+        data.insert(data.end(), bytes.begin(), bytes.end());
+
+        if (glyph.code_point >= 0x20 && glyph.code_point < 0x7F) {
+            ascii[glyph.code_point - 0x20] = value;
+        } else {
+            unicode.push_back({glyph.code_point, value});
+        }
+    }
+    std::sort(unicode.begin(), unicode.end());
+
+    // Font descriptor, the file size is patched in at the end
+    put_header(out, 0x00, 20);
+    put24(out, 0x464651);
+    put8(out, 0x01);
+    put32(out, 0);
+    put32(out, 0);
+    put8(out, line_height);
+    put8(out, 1);
+    put16(out, unicode.size());
+    put8(out, format);
+    put8(out, unicode.empty() ? 0 : 0x04);
+    put8(out, compression);
+    put8(out, 0xFF);
+
+    put_header(out, 0x01, ascii.size() * 3);
+    for (uint32_t value : ascii) {
+        put24(out, value);
+    }
+
+    if (!unicode.empty()) {
+        put_header(out, 0x02, unicode.size() * 6);
+        for (auto& entry : unicode) {
+            put24(out, entry.first);
+            put24(out, entry.second);
+        }
+    }
+
+    put_header(out, 0x04, data.size());
+    out.insert(out.end(), data.begin(), data.end());
+
+    uint32_t total = out.size();
+    for (int i = 0; i < 4; i++) {
+        out[9 + i]  = (total >> (8 * i)) & 0xFF;
+        out[13 + i] = (~total >> (8 * i)) & 0xFF;
+    }
+    return out;
+}
+
+std::vector<uint8_t> qpa_build_directory(const std::map<std::string, std::vector<uint8_t>>& assets) {
+    std::vector<uint8_t> out;
+
+    // Directory descriptor and entry table, with the map already sorted by name
+    put_header(out, 0x00, 6);
+    put24(out, 0x415051);
+    put8(out, 0x01);
+    put16(out, assets.size());
+    put_header(out, 0x01, assets.size() * 32);
+
+    uint32_t offset = out.size() + assets.size() * 32;
+    for (auto& asset : assets) {
+        std::string name = asset.first;
+        name.resize(24, '\0');
+        out.insert(out.end(), name.begin(), name.end());
+        put32(out, offset);
+        put32(out, asset.second.size());
+        offset += asset.second.size();
+    }
+
+    for (auto& asset : assets) {
+        out.insert(out.end(), asset.second.begin(), asset.second.end());
+    }
+    return out;
+}
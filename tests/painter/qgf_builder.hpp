@@ -0,0 +1,49 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "qp_internal.h"
+}
+
+/* Packs one palette index per pixel into the LSb-first layout used by QGF */
+std::vector<uint8_t> qgf_pack_pixels(const std::vector<uint8_t>& indices, uint8_t bpp);
+
+/* Compresses data with the same RLE scheme as `qmk painter-convert-graphics` */
+std::vector<uint8_t> qgf_compress_rle(const std::vector<uint8_t>& data);
+
+/* Builds a single frame QGF image from already packed (and compressed) pixel data */
+std::vector<uint8_t> qgf_build_image(uint16_t width, uint16_t height, qp_image_format_t format, painter_compression_t compression, const std::vector<uint8_t>& data);
+
+/* A frame of an animation, delta frames only cover the given rectangle */
+struct qgf_frame_t {
+    std::vector<uint8_t> data;
+    uint16_t             delay  = 0;
+    bool                 delta  = false;
+    uint16_t             left   = 0;
+    uint16_t             top    = 0;
+    uint16_t             right  = 0;
+    uint16_t             bottom = 0;
+};
+
+/* Builds a QGF animation, with every frame using the same format and compression */
+std::vector<uint8_t> qgf_build_animation(uint16_t width, uint16_t height, qp_image_format_t format, painter_compression_t compression, const std::vector<qgf_frame_t>& frames);
+
+/* A glyph of a font, with one palette index per pixel */
+struct qff_glyph_t {
+    uint32_t             code_point = 0;
+    uint8_t              width      = 0;
+    std::vector<uint8_t> indices;
+};
+
+/* Builds a grayscale QFF font, with an ascii table and a sorted unicode table for everything outside of 0x20..0x7E */
+std::vector<uint8_t> qff_build_font(uint8_t line_height, qp_image_format_t format, painter_compression_t compression, const std::vector<qff_glyph_t>& glyphs);
+
+/* Builds a QPA asset directory, followed by the assets themselves, as `qmk painter-pack-assets` does */
+std::vector<uint8_t> qpa_build_directory(const std::map<std::string, std::vector<uint8_t>>& assets);
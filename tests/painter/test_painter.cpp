@@ -0,0 +1,151 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "qgf_builder.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_draw.h"
+#include "qp_surface.h"
+}
+
+static const uint16_t WIDTH  = 240;
+static const uint16_t HEIGHT = 320;
+
+class Painter : public ::testing::Test {
+   protected:
+    /* Surfaces can't be released again, so all tests share the same one */
+    static std::vector<uint16_t> framebuffer;
+    static painter_device_t      surface;
+
+    static void SetUpTestSuite() {
+        if (surface == nullptr) {
+            framebuffer.assign(WIDTH * HEIGHT, 0);
+            surface = qp_make_rgb565_surface(WIDTH, HEIGHT, framebuffer.data());
+        }
+    }
+
+    void SetUp() override {
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+        std::fill(framebuffer.begin(), framebuffer.end(), 0);
+        qp_internal_invalidate_palette();
+    }
+
+    /* A gradient with long flat stretches, so RLE has both kinds of runs to work with */
+    static std::vector<uint8_t> make_indices(uint16_t width, uint16_t height, uint8_t bpp) {
+        std::vector<uint8_t> indices(width * height);
+        for (size_t i = 0; i < indices.size(); i++) {
+            size_t x   = i % width;
+            size_t y   = i / width;
+            indices[i] = ((x / 7) + (y % 3 == 0 ? x : 0)) & ((1 << bpp) - 1);
+        }
+        return indices;
+    }
+
+    void draw(uint16_t width, uint16_t height, qp_image_format_t format, painter_compression_t compression, const std::vector<uint8_t>& data) {
+        auto                   qgf   = qgf_build_image(width, height, format, compression, data);
+        painter_image_handle_t image = qp_load_image_mem(qgf.data());
+        ASSERT_NE(image, nullptr);
+        EXPECT_TRUE(qp_drawimage(surface, 0, 0, image));
+        qp_close_image(image);
+    }
+
+    void expect_pixels(uint16_t width, uint16_t height, const std::vector<uint8_t>& indices) {
+        for (uint16_t y = 0; y < height; y++) {
+            for (uint16_t x = 0; x < width; x++) {
+                uint16_t expected = qp_internal_global_pixel_lookup_table[indices[y * width + x]].rgb565;
+                ASSERT_EQ(framebuffer[y * WIDTH + x], expected) << "at " << x << "," << y;
+            }
+        }
+    }
+};
+
+std::vector<uint16_t> Painter::framebuffer;
+painter_device_t      Painter::surface;
+
+class PainterDecode : public Painter, public ::testing::WithParamInterface<std::tuple<qp_image_format_t, painter_compression_t>> {};
+
+TEST_P(PainterDecode, MatchesSourcePixels) {
+    auto [format, compression] = GetParam();
+    uint8_t bpp                = 1 << format;
+
+    // Odd sizes leave a partially used byte at the end of the image
+    for (auto size : {std::make_pair<uint16_t, uint16_t>(13, 7), std::make_pair(WIDTH, HEIGHT)}) {
+        auto indices = make_indices(size.first, size.second, bpp);
+        auto data    = qgf_pack_pixels(indices, bpp);
+        if (compression == IMAGE_COMPRESSED_RLE) {
+            data = qgf_compress_rle(data);
+        }
+
+        draw(size.first, size.second, format, compression, data);
+        expect_pixels(size.first, size.second, indices);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(Formats, PainterDecode, ::testing::Combine(::testing::Values(GRAYSCALE_1BPP, GRAYSCALE_2BPP, GRAYSCALE_4BPP, GRAYSCALE_8BPP), ::testing::Values(IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE)));
+
+TEST_F(Painter, NativePixelsAreCopied) {
+    std::vector<uint8_t> data(WIDTH * HEIGHT * 2);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = (i * 31) & 0xFF;
+    }
+
+    for (auto compression : {IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE}) {
+        std::fill(framebuffer.begin(), framebuffer.end(), 0);
+        draw(WIDTH, HEIGHT, RGB565_16BPP, compression, compression == IMAGE_COMPRESSED_RLE ? qgf_compress_rle(data) : data);
+        EXPECT_EQ(std::memcmp(framebuffer.data(), data.data(), data.size()), 0);
+    }
+}
+
+TEST_F(Painter, TruncatedImageFails) {
+    auto data = qgf_pack_pixels(make_indices(WIDTH, HEIGHT, 4), 4);
+    data.resize(data.size() / 2);
+
+    auto                   qgf   = qgf_build_image(WIDTH, HEIGHT, GRAYSCALE_4BPP, IMAGE_UNCOMPRESSED, data);
+    painter_image_handle_t image = qp_load_image_mem(qgf.data());
+    ASSERT_NE(image, nullptr);
+    EXPECT_FALSE(qp_drawimage(surface, 0, 0, image));
+    qp_close_image(image);
+}
+
+/* The block decoder gives the same pixels as decoding a byte and a pixel at a time, for a full screen image */
+TEST_F(Painter, BlockDecodeMatchesBytewise) {
+    const uint32_t pixels = WIDTH * HEIGHT;
+
+    for (auto compression : {IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE}) {
+        auto data = qgf_pack_pixels(make_indices(WIDTH, HEIGHT, 4), 4);
+        if (compression == IMAGE_COMPRESSED_RLE) {
+            data = qgf_compress_rle(data);
+        }
+        qp_memory_stream_t stream = qp_make_memory_stream(data.data(), data.size());
+        qp_internal_invalidate_palette();
+        ASSERT_TRUE(qp_internal_interpolate_palette(surface, {.hsv888 = {0, 0, 255}}, {.hsv888 = {0, 0, 0}}, 16));
+        ASSERT_TRUE(((painter_driver_t *)surface)->driver_vtable->palette_convert(surface, 16, qp_internal_global_pixel_lookup_table));
+
+        std::fill(framebuffer.begin(), framebuffer.end(), 0);
+        qp_internal_byte_input_state_t   bytewise_input = {.device = surface, .src_stream = &stream.base};
+        qp_internal_byte_input_callback  callback       = qp_internal_prepare_input_state(&bytewise_input, compression);
+        qp_internal_pixel_output_state_t output_state   = {.device = surface, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(surface)};
+        ASSERT_TRUE(qp_viewport(surface, 0, 0, WIDTH - 1, HEIGHT - 1));
+        ASSERT_TRUE(qp_internal_decode_palette(surface, pixels, 4, callback, &bytewise_input, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state));
+        if (output_state.pixel_write_pos > 0) {
+            ASSERT_TRUE(qp_pixdata(surface, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos));
+        }
+        auto expected = framebuffer;
+        ASSERT_NE(std::count(expected.begin(), expected.end(), 0), (ptrdiff_t)expected.size());
+
+        std::fill(framebuffer.begin(), framebuffer.end(), 0);
+        qp_stream_setpos(&stream, 0);
+        qp_internal_byte_input_state_t block_input = {.device = surface, .src_stream = &stream.base};
+        qp_internal_prepare_input_state(&block_input, compression);
+        ASSERT_TRUE(qp_viewport(surface, 0, 0, WIDTH - 1, HEIGHT - 1));
+        ASSERT_TRUE(qp_internal_appender(surface, 4, pixels, &block_input));
+
+        EXPECT_EQ(framebuffer, expected);
+    }
+}
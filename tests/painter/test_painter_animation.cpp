@@ -0,0 +1,179 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mock_panel.hpp"
+#include "qgf_builder.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_comms.h"
+#include "qp_draw.h"
+
+void qp_internal_animation_tick(void);
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+static const uint16_t SIZE  = 8;
+static const uint16_t DELAY = 50;
+
+class PainterAnimation : public ::testing::Test {
+   protected:
+    painter_driver_t panel = {
+        .driver_vtable         = &mock::driver_vtable,
+        .comms_vtable          = &mock::comms_vtable,
+        .panel_width           = 4 * SIZE,
+        .panel_height          = SIZE,
+        .native_bits_per_pixel = 16,
+    };
+    std::vector<painter_image_handle_t> images;
+    std::vector<deferred_token>         animations;
+
+    void SetUp() override {
+        set_time(1000);
+        ASSERT_TRUE(qp_init(&panel, QP_ROTATION_0));
+        qp_comms_wait();
+    }
+
+    void TearDown() override {
+        for (auto animation : animations) {
+            qp_stop_animation(animation);
+        }
+        for (auto image : images) {
+            qp_close_image(image);
+        }
+        qp_comms_wait();
+    }
+
+    /* Every frame is filled with palette index (frame number + 1), delta frames only cover the top left corner */
+    painter_image_handle_t load_animation(std::vector<uint8_t>& qgf, uint16_t frame_count, bool deltas) {
+        std::vector<qgf_frame_t> frames(frame_count);
+        for (uint16_t f = 0; f < frame_count; f++) {
+            bool     delta   = deltas && f > 0;
+            uint16_t size    = delta ? SIZE / 2 : SIZE;
+            frames[f].data   = qgf_pack_pixels(std::vector<uint8_t>(size * size, f + 1), 4);
+            frames[f].delay  = DELAY;
+            frames[f].delta  = delta;
+            frames[f].right  = size - 1;
+            frames[f].bottom = size - 1;
+        }
+        qgf                          = qgf_build_animation(SIZE, SIZE, GRAYSCALE_4BPP, IMAGE_UNCOMPRESSED, frames);
+        painter_image_handle_t image = qp_load_image_mem(qgf.data());
+        EXPECT_NE(image, nullptr);
+        images.push_back(image);
+        return image;
+    }
+
+    deferred_token animate(uint16_t x, painter_image_handle_t image) {
+        deferred_token token = qp_animate(&panel, x, 0, image);
+        EXPECT_NE(token, INVALID_DEFERRED_TOKEN);
+        animations.push_back(token);
+        return token;
+    }
+
+    /* Runs the animation tick, returning the frame numbers drawn as identified by their pixels */
+    std::vector<int> tick() {
+        qp_comms_wait();
+        mock::reset();
+        qp_internal_animation_tick();
+        qp_comms_wait();
+        EXPECT_EQ(mock::overlapped, 0);
+        EXPECT_EQ(mock::started, mock::stopped);
+
+        std::vector<int> frames;
+        for (size_t i = 1; i < mock::transfers.size(); i++) {
+            if (!mock::transfers[i - 1].async && mock::transfers[i].async) {
+                uint16_t pixel;
+                std::memcpy(&pixel, mock::transfers[i].data.data(), sizeof(pixel));
+                int frame = -1;
+                for (int index = 1; index < 16; index++) {
+                    if (qp_internal_global_pixel_lookup_table[index].rgb565 == pixel) {
+                        frame = index - 1;
+                    }
+                }
+                frames.push_back(frame);
+            }
+        }
+        return frames;
+    }
+};
+
+TEST_F(PainterAnimation, DueAnimationsShareOneUpdate) {
+    std::vector<uint8_t> qgf_a, qgf_b;
+    animate(0, load_animation(qgf_a, 2, false));
+    animate(SIZE, load_animation(qgf_b, 3, false));
+
+    advance_time(DELAY - 1);
+    EXPECT_EQ(tick(), std::vector<int>{});
+    EXPECT_EQ(mock::started, 0);
+
+    advance_time(1);
+    EXPECT_EQ(tick(), std::vector<int>({1, 1}));
+    EXPECT_EQ(mock::started, 1);
+
+    advance_time(DELAY);
+    EXPECT_EQ(tick(), std::vector<int>({0, 2}));
+    EXPECT_EQ(mock::started, 1);
+}
+
+TEST_F(PainterAnimation, LateFramesAreSkipped) {
+    std::vector<uint8_t> qgf;
+    animate(0, load_animation(qgf, 4, false));
+
+    // Frames 1 and 2 are overdue, only frame 3 is drawn
+    advance_time(3 * DELAY + 10);
+    EXPECT_EQ(tick(), std::vector<int>{3});
+
+    // The schedule stays on its original timing
+    advance_time(DELAY - 10);
+    EXPECT_EQ(tick(), std::vector<int>{0});
+    advance_time(DELAY);
+    EXPECT_EQ(tick(), std::vector<int>{1});
+}
+
+TEST_F(PainterAnimation, DeltaFramesAreNotSkipped) {
+    std::vector<uint8_t> qgf;
+    animate(0, load_animation(qgf, 4, true));
+
+    // Every frame depends on the previous one, so they're drawn in order without trying to catch up
+    advance_time(3 * DELAY + 10);
+    EXPECT_EQ(tick(), std::vector<int>{1});
+    EXPECT_EQ(tick(), std::vector<int>{});
+    advance_time(DELAY - 1);
+    EXPECT_EQ(tick(), std::vector<int>{});
+    advance_time(1);
+    EXPECT_EQ(tick(), std::vector<int>{2});
+    advance_time(DELAY);
+    EXPECT_EQ(tick(), std::vector<int>{3});
+}
+
+TEST_F(PainterAnimation, StoppedAnimationsAreNotDrawn) {
+    std::vector<uint8_t> qgf_a, qgf_b;
+    deferred_token       a = animate(0, load_animation(qgf_a, 2, false));
+    animate(SIZE, load_animation(qgf_b, 2, false));
+
+    qp_stop_animation(a);
+    advance_time(DELAY);
+    EXPECT_EQ(tick(), std::vector<int>{1});
+}
+
+TEST_F(PainterAnimation, TokensAreNotReusedWhileRunning) {
+    std::vector<uint8_t>   qgf_a, qgf_b;
+    deferred_token         running = animate(0, load_animation(qgf_a, 2, false));
+    painter_image_handle_t other   = load_animation(qgf_b, 2, false);
+
+    // Wrap the token counter around while the first animation keeps running
+    for (int i = 0; i < 300; i++) {
+        deferred_token token = qp_animate(&panel, SIZE, 0, other);
+        ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+        ASSERT_NE(token, running);
+        qp_stop_animation(token);
+    }
+
+    advance_time(DELAY);
+    EXPECT_EQ(tick(), std::vector<int>{1});
+}
@@ -0,0 +1,144 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mock_panel.hpp"
+#include "qgf_builder.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_comms.h"
+#include "qp_draw.h"
+#include "qp_surface.h"
+}
+
+static const uint16_t WIDTH  = 40;
+static const uint16_t HEIGHT = 30;
+
+class PainterComms : public ::testing::Test {
+   protected:
+    painter_driver_t panel = {
+        .driver_vtable         = &mock::driver_vtable,
+        .comms_vtable          = &mock::comms_vtable,
+        .panel_width           = WIDTH,
+        .panel_height          = HEIGHT,
+        .native_bits_per_pixel = 16,
+    };
+
+    void SetUp() override {
+        ASSERT_TRUE(qp_init(&panel, QP_ROTATION_0));
+        qp_comms_wait();
+        mock::reset();
+        qp_internal_invalidate_palette();
+    }
+
+    void TearDown() override {
+        qp_comms_wait();
+        EXPECT_EQ(mock::overlapped, 0);
+        EXPECT_EQ(mock::started, mock::stopped);
+    }
+
+    /* Pixel data received after the first viewport, as sent over the bus */
+    static std::vector<uint8_t> received_pixels() {
+        std::vector<uint8_t> pixels;
+        EXPECT_FALSE(mock::transfers.empty());
+        EXPECT_FALSE(mock::transfers.front().async);
+        for (size_t i = 1; i < mock::transfers.size(); i++) {
+            EXPECT_TRUE(mock::transfers[i].async);
+            pixels.insert(pixels.end(), mock::transfers[i].data.begin(), mock::transfers[i].data.end());
+        }
+        return pixels;
+    }
+};
+
+TEST_F(PainterComms, ImageIsSentInTheBackground) {
+    std::vector<uint8_t> indices(WIDTH * HEIGHT);
+    for (size_t i = 0; i < indices.size(); i++) {
+        indices[i] = (i * 7 + i / WIDTH) & 0x0F;
+    }
+
+    auto                   qgf   = qgf_build_image(WIDTH, HEIGHT, GRAYSCALE_4BPP, IMAGE_UNCOMPRESSED, qgf_pack_pixels(indices, 4));
+    painter_image_handle_t image = qp_load_image_mem(qgf.data());
+    ASSERT_NE(image, nullptr);
+    EXPECT_TRUE(qp_drawimage(&panel, 0, 0, image));
+    qp_close_image(image);
+
+    // The last transfer has completed and the bus has been released before drawing returns
+    EXPECT_EQ(mock::in_flight_data, nullptr);
+    EXPECT_EQ(mock::stopped, mock::started);
+
+    auto pixels = received_pixels();
+    ASSERT_EQ(pixels.size(), indices.size() * sizeof(uint16_t));
+    for (size_t i = 0; i < indices.size(); i++) {
+        uint16_t pixel;
+        std::memcpy(&pixel, &pixels[i * sizeof(uint16_t)], sizeof(pixel));
+        ASSERT_EQ(pixel, qp_internal_global_pixel_lookup_table[indices[i]].rgb565) << "at pixel " << i;
+    }
+}
+
+TEST_F(PainterComms, FilledRectUsesBothBuffers) {
+    EXPECT_TRUE(qp_rect(&panel, 0, 0, WIDTH - 1, HEIGHT - 1, 0, 255, 255, true));
+
+    qp_pixel_t color = {.hsv888 = {0, 255, 255}};
+    mock::palette_convert(&panel, 1, &color);
+
+    qp_comms_wait();
+    auto pixels = received_pixels();
+    ASSERT_EQ(pixels.size(), WIDTH * HEIGHT * sizeof(uint16_t));
+    for (size_t i = 0; i < WIDTH * HEIGHT; i++) {
+        uint16_t pixel;
+        std::memcpy(&pixel, &pixels[i * sizeof(uint16_t)], sizeof(pixel));
+        ASSERT_EQ(pixel, color.rgb565) << "at pixel " << i;
+    }
+}
+
+TEST_F(PainterComms, BusIsFreeBetweenDraws) {
+    // Another device on the bus is used straight after each draw, before anything else gets to run
+    EXPECT_TRUE(qp_rect(&panel, 0, 0, WIDTH - 1, HEIGHT - 1, 0, 0, 255, true));
+    ASSERT_TRUE(mock::other_device_start());
+    mock::other_device_stop();
+
+    EXPECT_TRUE(qp_rect(&panel, 0, 0, WIDTH - 1, HEIGHT - 1, 0, 255, 255, true));
+    ASSERT_TRUE(mock::other_device_start());
+    mock::other_device_stop();
+
+    qp_pixel_t colors[2] = {{.hsv888 = {0, 0, 255}}, {.hsv888 = {0, 255, 255}}};
+    mock::palette_convert(&panel, 2, colors);
+
+    // Both rects were sent in full, the second one after the first one's viewport and pixel data
+    std::vector<uint16_t> pixels;
+    size_t                viewports = 0;
+    for (auto &transfer : mock::transfers) {
+        if (!transfer.async) {
+            viewports++;
+            continue;
+        }
+        for (size_t i = 0; i < transfer.data.size(); i += sizeof(uint16_t)) {
+            uint16_t pixel;
+            std::memcpy(&pixel, &transfer.data[i], sizeof(pixel));
+            ASSERT_EQ(pixel, colors[viewports - 1].rgb565) << "in rect " << viewports;
+            pixels.push_back(pixel);
+        }
+    }
+    EXPECT_EQ(viewports, 2);
+    EXPECT_EQ(pixels.size(), 2 * WIDTH * HEIGHT);
+}
+
+TEST_F(PainterComms, SurfaceIsCopiedToPanel) {
+    static std::vector<uint16_t> framebuffer(WIDTH * HEIGHT);
+    static painter_device_t      surface = qp_make_rgb565_surface(WIDTH, HEIGHT, framebuffer.data());
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    for (size_t i = 0; i < framebuffer.size(); i++) {
+        framebuffer[i] = i * 37;
+    }
+
+    EXPECT_TRUE(qp_surface_draw(surface, &panel, 0, 0, true));
+    qp_comms_wait();
+
+    auto pixels = received_pixels();
+    ASSERT_EQ(pixels.size(), framebuffer.size() * sizeof(uint16_t));
+    EXPECT_EQ(std::memcmp(pixels.data(), framebuffer.data(), pixels.size()), 0);
+}
@@ -0,0 +1,167 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mock_flash.hpp"
+#include "mock_panel.hpp"
+#include "qgf_builder.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_comms.h"
+#include "qp_draw.h"
+#include "qp_stream.h"
+#include "qpa.h"
+}
+
+static const uint16_t WIDTH  = 40;
+static const uint16_t HEIGHT = 30;
+
+class PainterFlash : public ::testing::Test {
+   protected:
+    painter_driver_t panel = {
+        .driver_vtable         = &mock::driver_vtable,
+        .comms_vtable          = &mock::comms_vtable,
+        .panel_width           = WIDTH,
+        .panel_height          = HEIGHT,
+        .native_bits_per_pixel = 16,
+    };
+    std::vector<uint8_t> image;
+    std::vector<uint8_t> font;
+
+    void SetUp() override {
+        ASSERT_TRUE(qp_init(&panel, QP_ROTATION_0));
+        qp_comms_wait();
+        qp_internal_invalidate_palette();
+
+        std::vector<uint8_t> indices(WIDTH * HEIGHT);
+        for (size_t i = 0; i < indices.size(); i++) {
+            indices[i] = ((i % WIDTH) / 5 + (i / WIDTH) / 3) & 0x0F;
+        }
+        image = qgf_build_image(WIDTH, HEIGHT, GRAYSCALE_4BPP, IMAGE_COMPRESSED_RLE, qgf_compress_rle(qgf_pack_pixels(indices, 4)));
+
+        std::vector<qff_glyph_t> glyphs;
+        for (uint32_t code_point = '0'; code_point <= '9'; code_point++) {
+            qff_glyph_t glyph;
+            glyph.code_point = code_point;
+            glyph.width      = 4 + code_point % 3;
+            for (uint16_t i = 0; i < glyph.width * 8; i++) {
+                glyph.indices.push_back((code_point + i) & 3);
+            }
+            glyphs.push_back(glyph);
+        }
+        font = qff_build_font(8, GRAYSCALE_2BPP, IMAGE_COMPRESSED_RLE, glyphs);
+
+        write_flash(qpa_build_directory({{"digits", font}, {"ramp", image}}));
+    }
+
+    void TearDown() override {
+        qp_comms_wait();
+        EXPECT_EQ(mock::overlapped, 0);
+        EXPECT_EQ(mock::started, mock::stopped);
+        EXPECT_EQ(mock::flash_reads_on_held_bus, 0);
+    }
+
+    /* Puts the directory where the test config expects it, with erased flash in front of it */
+    static void write_flash(const std::vector<uint8_t>& directory) {
+        mock::flash.assign(QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS, 0xFF);
+        mock::flash.insert(mock::flash.end(), directory.begin(), directory.end());
+        qp_flash_stream_invalidate();
+        mock::reset_flash();
+        mock::reset();
+    }
+
+    /* Everything sent to the panel since the last call */
+    static std::vector<uint8_t> received() {
+        qp_comms_wait();
+        std::vector<uint8_t> data;
+        for (auto& transfer : mock::transfers) {
+            data.insert(data.end(), transfer.data.begin(), transfer.data.end());
+        }
+        mock::transfers.clear();
+        return data;
+    }
+};
+
+TEST_F(PainterFlash, ImageMatchesMemory) {
+    painter_image_handle_t mem = qp_load_image_mem(image.data());
+    ASSERT_NE(mem, nullptr);
+    EXPECT_TRUE(qp_drawimage(&panel, 0, 0, mem));
+    auto expected = received();
+    qp_close_image(mem);
+
+    painter_image_handle_t flash = qp_load_image_asset("ramp");
+    ASSERT_NE(flash, nullptr);
+    EXPECT_EQ(flash->width, WIDTH);
+    EXPECT_EQ(flash->height, HEIGHT);
+    EXPECT_TRUE(qp_drawimage(&panel, 0, 0, flash));
+    EXPECT_EQ(received(), expected);
+    EXPECT_GT(mock::flash_reads, 0);
+    qp_close_image(flash);
+}
+
+TEST_F(PainterFlash, TextMatchesMemory) {
+    painter_font_handle_t mem = qp_load_font_mem(font.data());
+    ASSERT_NE(mem, nullptr);
+    EXPECT_GT(qp_drawtext(&panel, 0, 0, mem, "0123456789"), 0);
+    auto expected = received();
+    qp_close_font(mem);
+
+    painter_font_handle_t flash = qp_load_font_asset("digits");
+    ASSERT_NE(flash, nullptr);
+    EXPECT_EQ(flash->line_height, 8);
+    EXPECT_GT(qp_drawtext(&panel, 0, 0, flash, "0123456789"), 0);
+    EXPECT_EQ(received(), expected);
+    qp_close_font(flash);
+}
+
+TEST_F(PainterFlash, SequentialReadsAreCached) {
+    painter_image_handle_t flash = qp_load_image_asset("ramp");
+    ASSERT_NE(flash, nullptr);
+    mock::reset_flash();
+
+    // Drawing reads the image front to back, one cache line at a time
+    EXPECT_TRUE(qp_drawimage(&panel, 0, 0, flash));
+    qp_comms_wait();
+    EXPECT_LE(mock::flash_bytes_read, image.size());
+    EXPECT_LE(mock::flash_reads, (int)(image.size() + QUANTUM_PAINTER_FLASH_CACHE_LINE_SIZE - 1) / QUANTUM_PAINTER_FLASH_CACHE_LINE_SIZE + 1);
+    qp_close_image(flash);
+}
+
+TEST_F(PainterFlash, AssetsAreFoundByName) {
+    std::map<std::string, std::vector<uint8_t>> assets;
+    for (int i = 0; i < 37; i++) {
+        assets["asset" + std::to_string(i * 7919 % 1000)] = std::vector<uint8_t>(i + 1, i);
+    }
+    assets["exactly_24_characters_xx"] = {0xAA};
+    write_flash(qpa_build_directory(assets));
+
+    for (auto& asset : assets) {
+        uint32_t address;
+        ASSERT_TRUE(qpa_find_flash_asset(asset.first.c_str(), &address)) << asset.first;
+        ASSERT_LE(address + asset.second.size(), mock::flash.size());
+        EXPECT_TRUE(std::equal(asset.second.begin(), asset.second.end(), mock::flash.begin() + address)) << asset.first;
+    }
+
+    uint32_t address;
+    EXPECT_FALSE(qpa_find_flash_asset("asset", &address));
+    EXPECT_FALSE(qpa_find_flash_asset("asset9999", &address));
+    EXPECT_FALSE(qpa_find_flash_asset("exactly_24_characters_xxx", &address));
+    EXPECT_EQ(qp_load_image_asset("missing"), nullptr);
+}
+
+TEST_F(PainterFlash, CorruptDirectoryIsRejected) {
+    auto directory = qpa_build_directory({{"ramp", image}});
+    directory[5] ^= 0xFF; // magic
+    write_flash(directory);
+    EXPECT_EQ(qp_load_image_asset("ramp"), nullptr);
+
+    // The asset itself is still intact, and can be loaded by address
+    painter_image_handle_t flash = qp_load_image_flash(QUANTUM_PAINTER_FLASH_ASSETS_ADDRESS + directory.size() - image.size());
+    EXPECT_NE(flash, nullptr);
+    qp_close_image(flash);
+}
@@ -0,0 +1,183 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "host_panel.hpp"
+#include "qgf_builder.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_draw.h"
+}
+
+/* Reference renderings, run with QP_UPDATE_GOLDEN=1 set to regenerate them after an intended change */
+static const char* GOLDEN_PATH = "tests/painter/golden/";
+/* Where renderings that don't match are written, for comparison */
+static const char* OUTPUT_PATH = ".build/test/";
+
+static const uint16_t WIDTH  = 96;
+static const uint16_t HEIGHT = 64;
+
+/* Digits and a colon, 3x5 pixels with one row/column of spacing, drawn at twice the size */
+static const uint8_t  FONT_SCALE  = 2;
+static const uint8_t  FONT_HEIGHT = 7 * FONT_SCALE;
+static const char*    FONT_CHARS  = "0123456789:";
+static const uint16_t FONT_BITMAPS[] = {
+    0x7B6F, 0x2C97, 0x73E7, 0x73CF, 0x5BC9, 0x79CF, 0x79EF, 0x7292, 0x7BEF, 0x7BCF, 0x0410,
+};
+
+class PainterGolden : public ::testing::Test {
+   protected:
+    host::panel_t         panel{WIDTH, HEIGHT};
+    std::vector<uint8_t>  qff;
+    painter_font_handle_t font = nullptr;
+
+    void SetUp() override {
+        ASSERT_TRUE(qp_init(panel.device(), QP_ROTATION_0));
+        qp_internal_invalidate_palette();
+    }
+
+    void TearDown() override {
+        if (font != nullptr) {
+            qp_close_font(font);
+        }
+    }
+
+    void load_font() {
+        std::vector<qff_glyph_t> glyphs;
+        for (size_t c = 0; FONT_CHARS[c] != 0; c++) {
+            qff_glyph_t glyph;
+            glyph.code_point = FONT_CHARS[c];
+            glyph.width      = 4 * FONT_SCALE;
+            for (uint8_t y = 0; y < FONT_HEIGHT; y++) {
+                for (uint8_t x = 0; x < glyph.width; x++) {
+                    uint8_t bx = x / FONT_SCALE;
+                    uint8_t by = y / FONT_SCALE - 1;
+                    bool    on = bx < 3 && by < 5 && (FONT_BITMAPS[c] >> (14 - by * 3 - bx)) & 1;
+                    glyph.indices.push_back(on);
+                }
+            }
+            glyphs.push_back(glyph);
+        }
+        qff  = qff_build_font(FONT_HEIGHT, GRAYSCALE_1BPP, IMAGE_COMPRESSED_RLE, glyphs);
+        font = qp_load_font_mem(qff.data());
+        ASSERT_NE(font, nullptr);
+    }
+
+    void expect_golden(const std::string& name) {
+        std::string golden = GOLDEN_PATH + name + ".ppm";
+        if (std::getenv("QP_UPDATE_GOLDEN") != nullptr) {
+            ASSERT_TRUE(panel.write_ppm(golden)) << "could not write " << golden;
+            return;
+        }
+
+        uint16_t           width, height;
+        std::vector<rgb_t> expected;
+        ASSERT_TRUE(host::read_ppm(golden, width, height, expected)) << "could not read " << golden;
+        ASSERT_EQ(width, panel.width());
+        ASSERT_EQ(height, panel.height());
+
+        size_t differences = 0;
+        for (size_t i = 0; i < expected.size(); i++) {
+            differences += std::memcmp(&expected[i], &panel.pixels()[i], sizeof(rgb_t)) != 0;
+        }
+        if (differences > 0) {
+            std::string actual = OUTPUT_PATH + name + ".png";
+            panel.write_png(actual);
+            ADD_FAILURE() << differences << " pixels differ from " << golden << ", the rendering was written to " << actual;
+        }
+    }
+};
+
+TEST_F(PainterGolden, Images) {
+    // Rings in 2bpp with RLE, recolored
+    std::vector<uint8_t> rings(32 * 32);
+    for (size_t i = 0; i < rings.size(); i++) {
+        int dx   = (int)(i % 32) - 16;
+        int dy   = (int)(i / 32) - 16;
+        rings[i] = ((dx * dx + dy * dy) / 40) & 3;
+    }
+    auto                   qgf   = qgf_build_image(32, 32, GRAYSCALE_2BPP, IMAGE_COMPRESSED_RLE, qgf_compress_rle(qgf_pack_pixels(rings, 2)));
+    painter_image_handle_t image = qp_load_image_mem(qgf.data());
+    ASSERT_NE(image, nullptr);
+    EXPECT_TRUE(qp_drawimage_recolor(panel.device(), 4, 4, image, 0, 255, 255, 170, 255, 64));
+    qp_close_image(image);
+
+    // Uncompressed 4bpp gradient
+    std::vector<uint8_t> gradient(48 * 40);
+    for (size_t i = 0; i < gradient.size(); i++) {
+        gradient[i] = ((i % 48) / 3) ^ ((i / 48) / 10);
+    }
+    qgf   = qgf_build_image(48, 40, GRAYSCALE_4BPP, IMAGE_UNCOMPRESSED, qgf_pack_pixels(gradient, 4));
+    image = qp_load_image_mem(qgf.data());
+    ASSERT_NE(image, nullptr);
+    EXPECT_TRUE(qp_drawimage(panel.device(), 44, 20, image));
+    qp_close_image(image);
+
+    expect_golden("images");
+}
+
+TEST_F(PainterGolden, Text) {
+    load_font();
+    EXPECT_GT(qp_drawtext(panel.device(), 2, 2, font, "12:34"), 0);
+    EXPECT_GT(qp_drawtext_recolor(panel.device(), 2, 18, font, "567", 85, 255, 255, 0, 0, 0), 0);
+    EXPECT_GT(qp_drawtext_line_recolor(panel.device(), 40, 18, 93, font, "890", nullptr, QP_TEXT_ALIGN_RIGHT, 170, 255, 255, 0, 0, 64), 0);
+    // Clipped at both ends of the box
+    EXPECT_GT(qp_drawtext_line_recolor(panel.device(), 13, 40, 82, font, "0123456789", nullptr, QP_TEXT_ALIGN_RIGHT, 43, 255, 255, 0, 0, 0), 0);
+    expect_golden("text");
+}
+
+TEST_F(PainterGolden, Circles) {
+    EXPECT_TRUE(qp_circle(panel.device(), 24, 32, 22, 0, 255, 255, true));
+    EXPECT_TRUE(qp_circle(panel.device(), 24, 32, 12, 0, 0, 255, false));
+    EXPECT_TRUE(qp_circle(panel.device(), 24, 32, 1, 0, 0, 255, true));
+    EXPECT_TRUE(qp_circle(panel.device(), 70, 32, 20, 85, 255, 255, false));
+    EXPECT_TRUE(qp_circle(panel.device(), 70, 32, 7, 170, 255, 255, true));
+    expect_golden("circles");
+}
+
+TEST_F(PainterGolden, Ellipses) {
+    EXPECT_TRUE(qp_ellipse(panel.device(), 24, 32, 22, 12, 170, 255, 255, true));
+    EXPECT_TRUE(qp_ellipse(panel.device(), 24, 32, 8, 28, 43, 255, 255, false));
+    EXPECT_TRUE(qp_ellipse(panel.device(), 70, 32, 20, 20, 0, 0, 255, false));
+    EXPECT_TRUE(qp_ellipse(panel.device(), 70, 32, 3, 16, 213, 255, 255, true));
+    expect_golden("ellipses");
+}
+
+/* Checks how much drawing sends to a panel, for the operations that should need a single block */
+TEST_F(PainterGolden, PanelTraffic) {
+    load_font();
+
+    auto qgf = qgf_build_image(WIDTH, HEIGHT, GRAYSCALE_4BPP, IMAGE_COMPRESSED_RLE, qgf_compress_rle(qgf_pack_pixels(std::vector<uint8_t>(WIDTH * HEIGHT, 5), 4)));
+    painter_image_handle_t image = qp_load_image_mem(qgf.data());
+    ASSERT_NE(image, nullptr);
+
+    auto expect_traffic = [&](const char* operation, uint32_t viewports, uint64_t pixels) {
+        EXPECT_EQ(panel.stats.viewports, viewports) << operation;
+        EXPECT_EQ(panel.stats.pixels, pixels) << operation;
+        EXPECT_EQ(panel.stats.bytes, viewports * host::VIEWPORT_BYTES + pixels * sizeof(rgb_t)) << operation;
+        panel.stats = {};
+    };
+
+    panel.stats = {};
+    EXPECT_TRUE(qp_drawimage(panel.device(), 0, 0, image));
+    expect_traffic("drawimage", 1, WIDTH * HEIGHT);
+
+    EXPECT_TRUE(qp_rect(panel.device(), 0, 0, WIDTH - 1, HEIGHT - 1, 0, 255, 255, true));
+    expect_traffic("rect", 1, WIDTH * HEIGHT);
+
+    // Only the last glyph differs, so only it is redrawn
+    EXPECT_GT(qp_drawtext_line(panel.device(), 0, 0, WIDTH - 1, font, "12:34:57", "12:34:56", QP_TEXT_ALIGN_RIGHT), 0);
+    expect_traffic("drawtext_line", 1, 4 * FONT_SCALE * FONT_HEIGHT);
+
+    // Runs of glyphs are sent as blocks rather than one viewport per glyph
+    EXPECT_GT(qp_drawtext(panel.device(), 0, 0, font, "12:34:56"), 0);
+    EXPECT_LT(panel.stats.viewports, 8);
+    EXPECT_EQ(panel.stats.pixels, 8 * 4 * FONT_SCALE * FONT_HEIGHT);
+
+    qp_close_image(image);
+}
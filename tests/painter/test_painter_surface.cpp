@@ -0,0 +1,209 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "host_panel.hpp"
+#include "mock_panel.hpp"
+#include "qgf_builder.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_comms.h"
+#include "qp_draw.h"
+#include "qp_surface_internal.h"
+}
+
+/* Rows don't start on a byte boundary for any of the packed formats */
+static const uint16_t WIDTH  = 37;
+static const uint16_t HEIGHT = 30;
+
+/* Every color drawn by draw_scene(), in the order they're introduced */
+static const hsv_t COLORS[] = {
+    {0, 0, 0}, {0, 255, 255}, {85, 255, 255}, {0, 0, 255}, {170, 255, 255}, {0, 0, 85}, {0, 0, 170},
+};
+static const size_t NUM_COLORS = sizeof(COLORS) / sizeof(COLORS[0]);
+
+/* Draws a scene using only the first `colors` entries of COLORS */
+static void draw_scene(painter_device_t device, size_t colors) {
+    EXPECT_TRUE(qp_rect(device, 0, 0, WIDTH - 1, HEIGHT - 1, 0, 0, 0, true));
+    if (colors >= 2) {
+        EXPECT_TRUE(qp_rect(device, 3, 2, 17, 11, 0, 255, 255, true));
+    }
+    if (colors >= 4) {
+        EXPECT_TRUE(qp_circle(device, 25, 15, 9, 85, 255, 255, true));
+        EXPECT_TRUE(qp_line(device, 0, HEIGHT - 1, WIDTH - 1, 0, 0, 0, 255));
+    }
+    if (colors >= NUM_COLORS) {
+        EXPECT_TRUE(qp_rect(device, 5, 20, 12, 27, 170, 255, 255, false));
+
+        // Grayscale images interpolate between black and white, giving the two grays
+        std::vector<uint8_t> indices(11 * 7);
+        for (size_t i = 0; i < indices.size(); i++) {
+            indices[i] = (i + i / 11) & 3;
+        }
+        auto                   qgf   = qgf_build_image(11, 7, GRAYSCALE_2BPP, IMAGE_UNCOMPRESSED, qgf_pack_pixels(indices, 2));
+        painter_image_handle_t image = qp_load_image_mem(qgf.data());
+        ASSERT_NE(image, nullptr);
+        EXPECT_TRUE(qp_drawimage(device, 23, 21, image));
+        qp_close_image(image);
+    }
+}
+
+class PainterSurface : public ::testing::Test {
+   protected:
+    surface_painter_device_t devices[2];
+    std::vector<hsv_t>       palette;
+    std::vector<uint8_t>     buffer;
+
+    void SetUp() override {
+        std::memset(devices, 0, sizeof(devices));
+        qp_internal_invalidate_palette();
+    }
+
+    /* A palette-indexed surface, with the first colors of its palette taken from COLORS and the rest left black */
+    painter_device_t make_surface(uint8_t bpp) {
+        palette.assign(1 << bpp, hsv_t{0, 0, 0});
+        std::copy(COLORS, COLORS + std::min(palette.size(), NUM_COLORS), palette.begin());
+        buffer.assign(SURFACE_REQUIRED_BUFFER_BYTE_SIZE(WIDTH, HEIGHT, bpp), 0);
+        painter_device_t surface = qp_make_palette_surface_advanced(devices, 2, WIDTH, HEIGHT, bpp, palette.data(), buffer.data());
+        EXPECT_NE(surface, nullptr);
+        EXPECT_TRUE(qp_init(surface, QP_ROTATION_0));
+        return surface;
+    }
+
+    uint8_t index_at(uint8_t bpp, uint16_t x, uint16_t y) const {
+        uint32_t pixel_num = y * WIDTH + x;
+        return (buffer[pixel_num * bpp / 8] >> ((pixel_num % (8 / bpp)) * bpp)) & ((1 << bpp) - 1);
+    }
+};
+
+class PainterPaletteSurface : public PainterSurface, public ::testing::WithParamInterface<uint8_t> {};
+
+TEST_P(PainterPaletteSurface, MatchesDirectDrawing) {
+    uint8_t          bpp     = GetParam();
+    size_t           colors  = std::min<size_t>(1 << bpp, NUM_COLORS);
+    painter_device_t surface = make_surface(bpp);
+
+    host::panel_t expected{WIDTH, HEIGHT};
+    ASSERT_TRUE(qp_init(expected.device(), QP_ROTATION_0));
+    draw_scene(expected.device(), colors);
+
+    host::panel_t actual{WIDTH, HEIGHT};
+    ASSERT_TRUE(qp_init(actual.device(), QP_ROTATION_0));
+    draw_scene(surface, colors);
+    EXPECT_TRUE(qp_surface_draw(surface, actual.device(), 0, 0, true));
+
+    EXPECT_EQ(std::memcmp(actual.pixels().data(), expected.pixels().data(), WIDTH * HEIGHT * sizeof(rgb_t)), 0);
+}
+
+TEST_P(PainterPaletteSurface, ExpandsToPackedTargets) {
+    uint8_t          bpp     = GetParam();
+    size_t           colors  = std::min<size_t>(1 << bpp, NUM_COLORS);
+    painter_device_t surface = make_surface(bpp);
+
+    std::vector<uint8_t> mono_buffer(SURFACE_REQUIRED_BUFFER_BYTE_SIZE(WIDTH, HEIGHT, 1));
+    painter_device_t     mono = qp_make_mono1bpp_surface_advanced(&devices[1], 1, WIDTH, HEIGHT, mono_buffer.data());
+    ASSERT_TRUE(qp_init(mono, QP_ROTATION_0));
+    draw_scene(mono, colors);
+    auto expected = mono_buffer;
+
+    // Reuse the same 1bpp surface as the target, starting from a cleared buffer
+    ASSERT_TRUE(qp_init(mono, QP_ROTATION_0));
+    draw_scene(surface, colors);
+    EXPECT_TRUE(qp_surface_draw(surface, mono, 0, 0, true));
+
+    EXPECT_EQ(mono_buffer, expected);
+}
+
+INSTANTIATE_TEST_CASE_P(Bpp, PainterPaletteSurface, ::testing::Values(1, 2, 4, 8));
+
+TEST_F(PainterSurface, ClosestColorIsUsed) {
+    painter_device_t surface = make_surface(2); // black, red, green, white
+
+    EXPECT_TRUE(qp_setpixel(surface, 0, 0, 0, 240, 250));
+    EXPECT_TRUE(qp_setpixel(surface, 1, 0, 0, 0, 200));
+    EXPECT_TRUE(qp_setpixel(surface, 2, 0, 80, 255, 128));
+    EXPECT_TRUE(qp_setpixel(surface, 3, 0, 0, 0, 30));
+
+    EXPECT_EQ(index_at(2, 0, 0), 1);
+    EXPECT_EQ(index_at(2, 1, 0), 3);
+    EXPECT_EQ(index_at(2, 2, 0), 2);
+    EXPECT_EQ(index_at(2, 3, 0), 0);
+}
+
+TEST_F(PainterSurface, DirtyRegionIsExpandedForPanel) {
+    painter_driver_t panel = {
+        .driver_vtable         = &mock::driver_vtable,
+        .comms_vtable          = &mock::comms_vtable,
+        .panel_width           = WIDTH,
+        .panel_height          = HEIGHT,
+        .native_bits_per_pixel = 16,
+    };
+    ASSERT_TRUE(qp_init(&panel, QP_ROTATION_0));
+
+    painter_device_t surface = make_surface(4);
+    EXPECT_TRUE(qp_surface_draw(surface, &panel, 0, 0, true));
+    qp_comms_wait();
+    mock::reset();
+
+    EXPECT_TRUE(qp_rect(surface, 5, 3, 9, 4, 0, 255, 255, true));
+    EXPECT_TRUE(qp_surface_draw(surface, &panel, 10, 20, false));
+    qp_comms_wait();
+
+    qp_pixel_t red = {.hsv888 = COLORS[1]};
+    mock::palette_convert(&panel, 1, &red);
+
+    ASSERT_FALSE(mock::transfers.empty());
+    std::vector<uint16_t> window(4);
+    ASSERT_EQ(mock::transfers.front().data.size(), window.size() * sizeof(uint16_t));
+    std::memcpy(window.data(), mock::transfers.front().data.data(), mock::transfers.front().data.size());
+    EXPECT_EQ(window, (std::vector<uint16_t>{15, 23, 19, 24}));
+
+    std::vector<uint8_t> pixels;
+    for (size_t i = 1; i < mock::transfers.size(); i++) {
+        pixels.insert(pixels.end(), mock::transfers[i].data.begin(), mock::transfers[i].data.end());
+    }
+    std::vector<uint16_t> expected(5 * 2, red.rgb565);
+    ASSERT_EQ(pixels.size(), expected.size() * sizeof(uint16_t));
+    EXPECT_EQ(std::memcmp(pixels.data(), expected.data(), pixels.size()), 0);
+
+    // Nothing has changed since, so nothing more is sent
+    mock::reset();
+    EXPECT_TRUE(qp_surface_draw(surface, &panel, 10, 20, false));
+    EXPECT_TRUE(mock::transfers.empty());
+
+    EXPECT_EQ(mock::overlapped, 0);
+    EXPECT_EQ(mock::started, mock::stopped);
+}
+
+TEST_F(PainterSurface, MonochromeIsDrawnToPanels) {
+    buffer.assign(SURFACE_REQUIRED_BUFFER_BYTE_SIZE(WIDTH, HEIGHT, 1), 0);
+    painter_device_t surface = qp_make_mono1bpp_surface_advanced(devices, 2, WIDTH, HEIGHT, buffer.data());
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+    host::panel_t expected{WIDTH, HEIGHT};
+    ASSERT_TRUE(qp_init(expected.device(), QP_ROTATION_0));
+    draw_scene(expected.device(), 1);
+    EXPECT_TRUE(qp_rect(expected.device(), 3, 2, 17, 11, 0, 0, 255, true));
+
+    host::panel_t actual{WIDTH, HEIGHT};
+    ASSERT_TRUE(qp_init(actual.device(), QP_ROTATION_0));
+    EXPECT_TRUE(qp_rect(surface, 3, 2, 17, 11, 0, 0, 255, true));
+    EXPECT_TRUE(qp_surface_draw(surface, actual.device(), 0, 0, true));
+
+    EXPECT_EQ(std::memcmp(actual.pixels().data(), expected.pixels().data(), WIDTH * HEIGHT * sizeof(rgb_t)), 0);
+}
+
+TEST_F(PainterSurface, DirectFormatsNeedMatchingTarget) {
+    std::vector<uint16_t> framebuffer(WIDTH * HEIGHT);
+    painter_device_t      surface = qp_make_rgb565_surface_advanced(devices, 2, WIDTH, HEIGHT, framebuffer.data());
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+    host::panel_t panel{WIDTH, HEIGHT};
+    ASSERT_TRUE(qp_init(panel.device(), QP_ROTATION_0));
+    EXPECT_FALSE(qp_surface_draw(surface, panel.device(), 0, 0, true));
+}
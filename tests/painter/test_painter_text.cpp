@@ -0,0 +1,228 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "mock_panel.hpp"
+#include "qgf_builder.hpp"
+
+extern "C" {
+#include "qp.h"
+#include "qp_comms.h"
+#include "qp_draw.h"
+}
+
+static const uint16_t WIDTH       = 96;
+static const uint8_t  LINE_HEIGHT = 8;
+static const uint16_t UNTOUCHED   = 0xBEEF;
+
+class PainterText : public ::testing::TestWithParam<painter_compression_t> {
+   protected:
+    painter_driver_t panel = {
+        .driver_vtable         = &mock::driver_vtable,
+        .comms_vtable          = &mock::comms_vtable,
+        .panel_width           = WIDTH,
+        .panel_height          = LINE_HEIGHT,
+        .native_bits_per_pixel = 16,
+    };
+    std::vector<uint8_t>  qff;
+    painter_font_handle_t font = nullptr;
+    /* What the panel has received so far, and the number of viewports in the last update */
+    std::vector<uint16_t> screen;
+    int                   viewports = 0;
+
+    /* Digits have a few different widths, W doesn't fit into the text buffer of the test config */
+    static uint8_t glyph_width(uint32_t code_point) {
+        return code_point == 'W' ? 20 : 3 + code_point % 3;
+    }
+
+    static uint8_t glyph_index(uint32_t code_point, uint16_t x, uint16_t y) {
+        return (code_point + x * 3 + y) & 3;
+    }
+
+    void SetUp() override {
+        ASSERT_TRUE(qp_init(&panel, QP_ROTATION_0));
+        qp_comms_wait();
+        qp_internal_invalidate_palette();
+
+        std::vector<qff_glyph_t> glyphs;
+        for (uint32_t code_point : {(uint32_t)' ', (uint32_t)':', (uint32_t)'W', (uint32_t)0xB0}) {
+            glyphs.push_back(make_glyph(code_point));
+        }
+        for (uint32_t code_point = '0'; code_point <= '9'; code_point++) {
+            glyphs.push_back(make_glyph(code_point));
+        }
+        qff  = qff_build_font(LINE_HEIGHT, GRAYSCALE_2BPP, GetParam(), glyphs);
+        font = qp_load_font_mem(qff.data());
+        ASSERT_NE(font, nullptr);
+
+        screen.assign(WIDTH * LINE_HEIGHT, UNTOUCHED);
+        mock::reset();
+    }
+
+    void TearDown() override {
+        qp_close_font(font);
+        qp_comms_wait();
+    }
+
+    static qff_glyph_t make_glyph(uint32_t code_point) {
+        qff_glyph_t glyph;
+        glyph.code_point = code_point;
+        glyph.width      = glyph_width(code_point);
+        for (uint16_t y = 0; y < LINE_HEIGHT; y++) {
+            for (uint16_t x = 0; x < glyph.width; x++) {
+                glyph.indices.push_back(glyph_index(code_point, x, y));
+            }
+        }
+        return glyph;
+    }
+
+    /* Plays back everything sent to the panel onto the screen */
+    void receive() {
+        qp_comms_wait();
+        uint16_t window[4] = {0, 0, 0, 0};
+        uint32_t pos       = 0;
+        viewports          = 0;
+        for (auto& transfer : mock::transfers) {
+            if (!transfer.async) {
+                std::memcpy(window, transfer.data.data(), sizeof(window));
+                pos = 0;
+                viewports++;
+                continue;
+            }
+            for (size_t i = 0; i + 1 < transfer.data.size(); i += 2, pos++) {
+                uint16_t w = window[2] - window[0] + 1;
+                uint16_t x = window[0] + pos % w;
+                uint16_t y = window[1] + pos / w;
+                ASSERT_LE(y, window[3]) << "more pixels than the viewport holds";
+                std::memcpy(&screen[y * WIDTH + x], &transfer.data[i], sizeof(uint16_t));
+            }
+        }
+        mock::reset();
+    }
+
+    static std::vector<uint32_t> code_points(const char* str) {
+        std::vector<uint32_t> out;
+        for (const uint8_t* p = (const uint8_t*)str; *p; p++) {
+            if ((*p & 0xE0) == 0xC0) {
+                out.push_back(((p[0] & 0x1F) << 6) | (p[1] & 0x3F));
+                p++;
+            } else {
+                out.push_back(*p);
+            }
+        }
+        return out;
+    }
+
+    static int16_t width_of(const char* str) {
+        int16_t width = 0;
+        for (uint32_t code_point : code_points(str)) {
+            width += glyph_width(code_point);
+        }
+        return width;
+    }
+
+    /* Checks that the columns between left and right show the string starting at xpos */
+    void expect_text(int16_t xpos, const char* str, int16_t left, int16_t right) {
+        for (uint32_t code_point : code_points(str)) {
+            for (uint16_t x = 0; x < glyph_width(code_point); x++) {
+                if (xpos + x < left || xpos + x > right) {
+                    continue;
+                }
+                for (uint16_t y = 0; y < LINE_HEIGHT; y++) {
+                    uint16_t expected = qp_internal_global_pixel_lookup_table[glyph_index(code_point, x, y)].rgb565;
+                    ASSERT_EQ(screen[y * WIDTH + xpos + x], expected) << "glyph " << code_point << " at " << x << "," << y;
+                }
+            }
+            xpos += glyph_width(code_point);
+        }
+    }
+
+    void expect_columns(int16_t left, int16_t right, uint16_t value) {
+        for (int16_t x = left; x <= right; x++) {
+            for (uint16_t y = 0; y < LINE_HEIGHT; y++) {
+                ASSERT_EQ(screen[y * WIDTH + x], value) << "at " << x << "," << y;
+            }
+        }
+    }
+};
+
+TEST_P(PainterText, MatchesGlyphs) {
+    const char* text = "12:34W5\xC2\xB0";
+    EXPECT_EQ(qp_drawtext(&panel, 2, 0, font, text), width_of(text));
+    receive();
+
+    expect_text(2, text, 0, WIDTH - 1);
+    expect_columns(0, 1, UNTOUCHED);
+    expect_columns(2 + width_of(text), WIDTH - 1, UNTOUCHED);
+}
+
+TEST_P(PainterText, RunOfGlyphsIsSentAsOneBlock) {
+    // 15 pixels wide, which fits into the 16 pixels of the text buffer
+    EXPECT_EQ(qp_drawtext(&panel, 0, 0, font, "0123"), 15);
+    receive();
+    EXPECT_EQ(viewports, 1);
+    expect_text(0, "0123", 0, WIDTH - 1);
+
+    // Longer runs are split where the buffer fills up, and W is sent on its own
+    qp_drawtext(&panel, 0, 0, font, "01230W");
+    receive();
+    EXPECT_EQ(viewports, 3);
+    expect_text(0, "01230W", 0, WIDTH - 1);
+}
+
+TEST_P(PainterText, LineIsAlignedAndClipped) {
+    const char* text = "0123456789";
+    EXPECT_EQ(qp_drawtext_line(&panel, 10, 0, 30, font, text, nullptr, QP_TEXT_ALIGN_RIGHT), width_of(text));
+    receive();
+    expect_text(31 - width_of(text), text, 10, 30);
+    expect_columns(0, 9, UNTOUCHED);
+    expect_columns(31, WIDTH - 1, UNTOUCHED);
+
+    qp_drawtext_line(&panel, 40, 0, 50, font, text, nullptr, QP_TEXT_ALIGN_LEFT);
+    receive();
+    expect_text(40, text, 40, 50);
+    expect_columns(51, WIDTH - 1, UNTOUCHED);
+}
+
+TEST_P(PainterText, OnlyChangedGlyphsAreRedrawn) {
+    qp_drawtext_line(&panel, 0, 0, WIDTH - 1, font, "12:34", nullptr, QP_TEXT_ALIGN_LEFT);
+    receive();
+
+    screen.assign(WIDTH * LINE_HEIGHT, UNTOUCHED);
+    qp_drawtext_line(&panel, 0, 0, WIDTH - 1, font, "12:35", "12:34", QP_TEXT_ALIGN_LEFT);
+    receive();
+    EXPECT_EQ(viewports, 1);
+    int16_t xpos = width_of("12:3");
+    expect_columns(0, xpos - 1, UNTOUCHED);
+    expect_text(xpos, "5", 0, WIDTH - 1);
+    expect_columns(xpos + width_of("5"), WIDTH - 1, UNTOUCHED);
+}
+
+TEST_P(PainterText, ShorterLineClearsTheRest) {
+    qp_drawtext_line(&panel, 0, 0, WIDTH - 1, font, "12345", nullptr, QP_TEXT_ALIGN_RIGHT);
+    receive();
+
+    // The remaining glyphs stay where they were, so only the vacated part is drawn
+    screen.assign(WIDTH * LINE_HEIGHT, UNTOUCHED);
+    qp_drawtext_line(&panel, 0, 0, WIDTH - 1, font, "45", "12345", QP_TEXT_ALIGN_RIGHT);
+    receive();
+    int16_t xpos = WIDTH - width_of("45");
+    expect_columns(0, WIDTH - width_of("12345") - 1, UNTOUCHED);
+    expect_columns(WIDTH - width_of("12345"), xpos - 1, 0);
+    expect_columns(xpos, WIDTH - 1, UNTOUCHED);
+
+    // Left aligned, every glyph moves
+    qp_drawtext_line(&panel, 0, 0, WIDTH - 1, font, "45", nullptr, QP_TEXT_ALIGN_LEFT);
+    receive();
+    screen.assign(WIDTH * LINE_HEIGHT, UNTOUCHED);
+    qp_drawtext_line(&panel, 0, 0, WIDTH - 1, font, "5", "45", QP_TEXT_ALIGN_LEFT);
+    receive();
+    expect_text(0, "5", 0, WIDTH - 1);
+    expect_columns(width_of("5"), width_of("45") - 1, 0);
+    expect_columns(width_of("45"), WIDTH - 1, UNTOUCHED);
+}
+
+INSTANTIATE_TEST_CASE_P(Compression, PainterText, ::testing::Values(IMAGE_UNCOMPRESSED, IMAGE_COMPRESSED_RLE));
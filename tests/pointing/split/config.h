@@ -0,0 +1,10 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// The sensor is on the other half, is_keyboard_left() is always true in tests
+#define SPLIT_POINTING_ENABLE
+#define POINTING_DEVICE_RIGHT
@@ -0,0 +1,6 @@
+POINTING_DEVICE_ENABLE = yes
+MOUSEKEY_ENABLE = no
+POINTING_DEVICE_DRIVER = custom
+
+# Only the split headers, the test stands in for the split transport
+VPATH += $(QUANTUM_PATH)/split_common
@@ -0,0 +1,110 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+
+class SplitPointing : public TestFixture {
+   protected:
+    pointing_device_shared_motion_t motion = {};
+
+    void SetUp() override {
+        pointing_device_reset_shared_motion();
+    }
+
+    /* Hands over the running totals of the other half, as the split transport does */
+    void move(int16_t x, int16_t y) {
+        motion.x += x;
+        motion.y += y;
+        pointing_device_set_shared_motion(&motion);
+    }
+};
+
+TEST_F(SplitPointing, FirstTotalsAreOnlyAReference) {
+    TestDriver driver;
+
+    motion.x = 1000;
+    move(0, 0);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+
+    move(5, -3);
+    EXPECT_MOUSE_REPORT(driver, (5, -3, 0, 0, 0));
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitPointing, TotalsWrapAround) {
+    TestDriver driver;
+
+    motion.x = UINT16_MAX - 5;
+    motion.y = 3;
+    move(0, 0);
+    run_one_scan_loop();
+
+    move(10, -10);
+    EXPECT_MOUSE_REPORT(driver, (10, -10, 0, 0, 0));
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitPointing, ReconnectStartsFromNewTotals) {
+    TestDriver driver;
+
+    move(0, 0);
+    move(20, 0);
+    EXPECT_MOUSE_REPORT(driver, (20, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The other half restarts from zero after the link dropped */
+    pointing_device_reset_shared_motion();
+    motion = {};
+    move(0, 0);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    move(0, 7);
+    EXPECT_MOUSE_REPORT(driver, (0, 7, 0, 0, 0));
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitPointing, UnsentMotionIsCapped) {
+    TestDriver driver;
+
+    /* A fast flick, much more than fits into a few reports */
+    move(0, 0);
+    for (int i = 0; i < 10; i++) {
+        move(3000, 0);
+    }
+
+    int32_t sent = 0;
+    EXPECT_CALL(driver, send_mouse_mock(_)).WillRepeatedly([&sent](report_mouse_t& report) { sent += report.x; });
+    for (int i = 0; i < 20; i++) {
+        run_one_scan_loop();
+    }
+
+    /* Two reports worth at most once the hand has stopped */
+    EXPECT_EQ(sent, 2 * (MOUSE_REPORT_XY_MAX + 1));
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitPointing, SharedReportsAddUp) {
+    TestDriver driver;
+
+    pointing_device_set_shared_report({.x = 4, .y = 1});
+    pointing_device_set_shared_report({.x = 2, .y = 1});
+    EXPECT_MOUSE_REPORT(driver, (6, 2, 0, 0, 0));
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
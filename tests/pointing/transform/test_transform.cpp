@@ -0,0 +1,155 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+extern "C" {
+#include "pointing_device_transform.h"
+}
+
+using testing::_;
+
+class PointingTransform : public TestFixture {
+   protected:
+    void SetUp() override {
+        eeconfig_update_pointing_device_default();
+        pointing_device_set_drag_scroll(false);
+        pointing_device_transform_init();
+    }
+
+    void TearDown() override {
+        pd_clear_movement();
+        pointing_device_set_drag_scroll(false);
+    }
+};
+
+TEST_F(PointingTransform, DefaultsPassMotionThrough) {
+    TestDriver driver;
+
+    pd_set_x(-10);
+    pd_set_y(20);
+    EXPECT_MOUSE_REPORT(driver, (-10, 20, 0, 0, 0));
+    run_one_scan_loop();
+
+    pd_clear_movement();
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingTransform, LowSensitivityKeepsFractions) {
+    TestDriver driver;
+    pointing_device_set_sensitivity(4);
+
+    /* A quarter of a count per scan makes one count every fourth scan */
+    pd_set_x(1);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    pd_set_x(-1);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (-1, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingTransform, OverflowIsSentWithTheNextReport) {
+    TestDriver driver;
+    pointing_device_set_sensitivity(32);
+
+    pd_set_x(100);
+    EXPECT_MOUSE_REPORT(driver, (MOUSE_REPORT_XY_MAX, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    pd_clear_movement();
+    EXPECT_MOUSE_REPORT(driver, (200 - MOUSE_REPORT_XY_MAX, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingTransform, AccelerationCurveIsInterpolated) {
+    EXPECT_EQ(pointing_device_get_acceleration_gain(100), POINTING_DEVICE_TRANSFORM_ONE);
+
+    pointing_device_set_acceleration(UINT8_MAX);
+    EXPECT_EQ(pointing_device_get_acceleration_gain(0), 256);
+    EXPECT_EQ(pointing_device_get_acceleration_gain(4), 256);
+    EXPECT_EQ(pointing_device_get_acceleration_gain(10), 320);
+    EXPECT_EQ(pointing_device_get_acceleration_gain(32), 576);
+    EXPECT_EQ(pointing_device_get_acceleration_gain(1000), 1024);
+
+    /* Half of the acceleration halves the extra gain */
+    pointing_device_set_acceleration(UINT8_MAX / 2 + 1);
+    EXPECT_EQ(pointing_device_get_acceleration_gain(1000), 256 + 768 * 128 / 255);
+}
+
+TEST_F(PointingTransform, AccelerationScalesFastMotion) {
+    TestDriver driver;
+    pointing_device_set_acceleration(UINT8_MAX);
+
+    pd_set_x(2);
+    EXPECT_MOUSE_REPORT(driver, (2, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    pd_set_x(16);
+    EXPECT_MOUSE_REPORT(driver, (24, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingTransform, DragScrollAccumulatesWheelSteps) {
+    TestDriver driver;
+    pointing_device_set_drag_scroll(true);
+
+    /* The default divisor makes a wheel step every 16 counts */
+    pd_set_y(4);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 1, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    pd_set_y(0);
+    pd_set_x(-32);
+    EXPECT_MOUSE_REPORT(driver, (0, 0, -2, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingTransform, SettingsArePersisted) {
+    pointing_device_set_sensitivity(20);
+    pointing_device_set_acceleration(100);
+    pointing_device_set_scroll_divisor(0);
+    EXPECT_EQ(pointing_device_get_scroll_divisor(), 1);
+
+    pointing_device_set_sensitivity_noeeprom(40);
+    pointing_device_transform_init();
+    EXPECT_EQ(pointing_device_get_sensitivity(), 20);
+    EXPECT_EQ(pointing_device_get_acceleration(), 100);
+    EXPECT_EQ(pointing_device_get_scroll_divisor(), 1);
+}
@@ -0,0 +1,212 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_usb_host.hpp"
+#include <cstring>
+#include "timer.h"
+
+TestUsbHost* TestUsbHost::m_this = nullptr;
+
+namespace {
+bool has_key(const uint8_t* keys, uint8_t key) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (keys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t count_bits(uint8_t value) {
+    return __builtin_popcount(value);
+}
+
+// Number of keys and modifiers that are pressed in `next` but not in `prev`.
+uint32_t count_presses(const report_queue_entry_t& prev, const report_queue_entry_t& next) {
+    static const uint8_t empty[REPORT_QUEUE_REPORT_SIZE] = {0};
+    const uint8_t*       before                          = (prev.kind == next.kind && prev.size == next.size) ? prev.data : empty;
+    uint32_t             presses                         = 0;
+
+    if (next.kind == REPORT_QUEUE_KEYBOARD) {
+        uint8_t mods = next.size - 2 - KEYBOARD_REPORT_KEYS;
+        presses += count_bits(next.data[mods] & ~before[mods]);
+        for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+            uint8_t key = next.data[mods + 2 + i];
+            if (key && !has_key(&before[mods + 2], key)) {
+                presses++;
+            }
+        }
+    } else {
+        for (uint8_t i = 1; i < next.size; i++) {
+            presses += count_bits(next.data[i] & ~before[i]);
+        }
+    }
+
+    return presses;
+}
+} // namespace
+
+TestUsbHost::TestUsbHost(uint32_t poll_interval_us, uint8_t endpoint_capacity, bool report_queue) : m_driver{&TestUsbHost::keyboard_leds, &TestUsbHost::send_keyboard, &TestUsbHost::send_nkro, &TestUsbHost::send_mouse, &TestUsbHost::send_extra}, m_poll_interval_us(poll_interval_us), m_endpoint_capacity(endpoint_capacity), m_use_queue(report_queue) {
+    host_set_driver(&m_driver);
+    m_this         = this;
+    m_now_us       = timer_read32() * 1000;
+    m_next_poll_us = m_now_us;
+    m_last_scan_us = m_now_us;
+}
+
+TestUsbHost::~TestUsbHost() {
+    m_this = nullptr;
+}
+
+uint8_t TestUsbHost::keyboard_leds(void) {
+    return 0;
+}
+
+void TestUsbHost::send_keyboard(report_keyboard_t* report) {
+    m_this->send(REPORT_QUEUE_KEYBOARD, report, sizeof(report_keyboard_t));
+}
+
+void TestUsbHost::send_nkro(report_nkro_t* report) {
+    m_this->send(REPORT_QUEUE_NKRO, report, sizeof(report_nkro_t));
+}
+
+// Mouse and extra reports are not modelled and reach the host instantly.
+void TestUsbHost::send_mouse(report_mouse_t* report) {}
+
+void TestUsbHost::send_extra(report_extra_t* report) {}
+
+void TestUsbHost::set_idle(uint8_t duration) {
+    sync();
+    m_idle_us = duration * 4000;
+}
+
+const report_queue_entry_t& TestUsbHost::get_report() {
+    sync();
+    return m_last_received;
+}
+
+void TestUsbHost::sync() {
+    poll_until(now_us());
+}
+
+const std::vector<TestUsbHost::Report>& TestUsbHost::received() {
+    sync();
+    return m_received;
+}
+
+const TestUsbHost::Statistics& TestUsbHost::statistics() {
+    sync();
+    return m_stats;
+}
+
+uint32_t TestUsbHost::average_latency_us() {
+    sync();
+    return m_stats.received ? m_stats.total_latency_us / m_stats.received : 0;
+}
+
+uint32_t TestUsbHost::lost_presses() {
+    sync();
+    return m_stats.presses_sent - m_stats.presses_received;
+}
+
+uint32_t TestUsbHost::now_us() {
+    uint32_t now = timer_read32() * 1000;
+    if (now > m_now_us) {
+        m_now_us = now;
+    }
+    return m_now_us;
+}
+
+void TestUsbHost::send(report_queue_kind_t kind, const void* report, uint8_t size) {
+    poll_until(now_us());
+
+    report_queue_entry_t entry = {};
+    entry.kind                 = kind;
+    entry.size                 = size;
+    memcpy(entry.data, report, size);
+
+    m_stats.sent++;
+    m_stats.presses_sent += count_presses(m_last_sent, entry);
+    m_last_sent = entry;
+
+    if (m_use_queue) {
+        // Keep the send time of every queued report, a merged report keeps
+        // the time of the report it was merged into.
+        uint8_t count = m_queue.count;
+        uint8_t head  = m_queue.head;
+        report_queue_push(&m_queue, kind, report, size);
+        if (m_queue.head != head) {
+            m_queue_sent_us.pop_front();
+            count--;
+        }
+        if (m_queue.count > count) {
+            m_queue_sent_us.push_back(m_now_us);
+        }
+        move_queue_into_endpoint();
+        return;
+    }
+
+    if (m_endpoint.size() >= m_endpoint_capacity) {
+        // The sender blocks until the next poll frees a buffer.
+        m_stats.stalls++;
+        m_stats.stalled_us += m_next_poll_us - m_now_us;
+        m_now_us = m_next_poll_us;
+        poll_until(m_now_us);
+    }
+
+    m_endpoint.push_back({m_now_us, entry});
+}
+
+void TestUsbHost::move_queue_into_endpoint() {
+    const report_queue_entry_t* entry;
+    while ((entry = report_queue_peek(&m_queue)) != nullptr && m_endpoint.size() < m_endpoint_capacity) {
+        m_endpoint.push_back({m_queue_sent_us.front(), *entry});
+        m_queue_sent_us.pop_front();
+        report_queue_pop(&m_queue);
+    }
+}
+
+void TestUsbHost::poll_until(uint32_t time_us) {
+    while (m_next_poll_us <= time_us) {
+        poll(m_next_poll_us);
+        m_next_poll_us += m_poll_interval_us;
+    }
+}
+
+void TestUsbHost::poll(uint32_t time_us) {
+    // The report queue task runs once per scan loop, which is every 1 ms.
+    uint32_t scan_us = time_us - time_us % 1000;
+    if (m_use_queue && scan_us > m_last_scan_us) {
+        m_last_scan_us = scan_us;
+        move_queue_into_endpoint();
+    }
+
+    Report received = {};
+    received.received_us = time_us;
+
+    if (!m_endpoint.empty()) {
+        received.sent_us = m_endpoint.front().sent_us;
+        received.report  = m_endpoint.front().report;
+        m_endpoint.pop_front();
+
+        uint32_t latency = time_us - received.sent_us;
+        m_stats.received++;
+        m_stats.total_latency_us += latency;
+        if (latency > m_stats.max_latency_us) {
+            m_stats.max_latency_us = latency;
+        }
+        m_stats.presses_received += count_presses(m_last_received, received.report);
+    } else if (m_idle_us != 0 && m_last_received.size != 0 && time_us - m_last_rx_us >= m_idle_us) {
+        received.sent_us     = time_us;
+        received.report      = m_last_received;
+        received.idle_repeat = true;
+        m_stats.idle_repeats++;
+    } else {
+        // NAK, nothing to send
+        return;
+    }
+
+    m_last_received = received.report;
+    m_last_rx_us    = time_us;
+    m_received.push_back(received);
+}
@@ -0,0 +1,117 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include "host.h"
+extern "C" {
+#include "report_queue.h"
+}
+
+/**
+ * @brief A host driver that models how a USB host receives keyboard reports.
+ *
+ * Instead of accepting every report instantly like TestDriver, reports wait
+ * in an endpoint with `endpoint_capacity` buffers until the host polls the
+ * endpoint, once every `poll_interval_us`. The model mimics the ChibiOS
+ * driver in tmk_core/protocol/chibios, but doesn't run its code:
+ *
+ * - Without the report queue a sender blocks on a full endpoint until the
+ *   next poll frees a buffer, which is counted as a stall.
+ * - With the report queue (USB_REPORT_QUEUE_ENABLE) reports are coalesced in
+ *   a report_queue_t and moved into the endpoint once per scan loop. Only the
+ *   queue itself is the real report_queue.c. How usb_main.c moves it into the
+ *   endpoint, and the boot protocol report size, are not covered.
+ * - SET_IDLE makes the host receive the last report again once the idle
+ *   period elapses without a new one, GET_REPORT returns the last report the
+ *   host received.
+ *
+ * Time is taken from the test timer, so events are only known to the scan
+ * loop resolution of 1 ms, while polls happen at their exact time.
+ */
+class TestUsbHost {
+   public:
+    struct Report {
+        /* time the report was handed to the driver, or when the sender could continue */
+        uint32_t             sent_us;
+        /* time the host polled the report */
+        uint32_t             received_us;
+        bool                 idle_repeat;
+        report_queue_entry_t report;
+    };
+
+    struct Statistics {
+        uint32_t sent;
+        uint32_t received;
+        uint32_t idle_repeats;
+        uint32_t stalls;
+        uint32_t stalled_us;
+        uint32_t max_latency_us;
+        uint64_t total_latency_us;
+        /* key and modifier presses in the sent reports and as seen by the host */
+        uint32_t presses_sent;
+        uint32_t presses_received;
+    };
+
+    TestUsbHost(uint32_t poll_interval_us = 1000, uint8_t endpoint_capacity = 4, bool report_queue = false);
+    ~TestUsbHost();
+
+    /* HID SET_IDLE, the duration is in units of 4 ms and 0 disables idle reports */
+    void set_idle(uint8_t duration);
+    /* HID GET_REPORT */
+    const report_queue_entry_t& get_report();
+
+    /* Let the host poll up to the current time */
+    void sync();
+
+    const std::vector<Report>& received();
+    const Statistics&          statistics();
+    const report_queue_stats_t& report_queue_statistics() const {
+        return m_queue.stats;
+    }
+
+    /* average latency between sending a report and the host receiving it */
+    uint32_t average_latency_us();
+    /* presses the host never saw, because reports were merged or dropped */
+    uint32_t lost_presses();
+
+   private:
+    struct Pending {
+        uint32_t             sent_us;
+        report_queue_entry_t report;
+    };
+
+    static uint8_t keyboard_leds(void);
+    static void    send_keyboard(report_keyboard_t* report);
+    static void    send_nkro(report_nkro_t* report);
+    static void    send_mouse(report_mouse_t* report);
+    static void    send_extra(report_extra_t* report);
+
+    void     send(report_queue_kind_t kind, const void* report, uint8_t size);
+    void     poll_until(uint32_t time_us);
+    void     poll(uint32_t time_us);
+    void     move_queue_into_endpoint();
+    uint32_t now_us();
+
+    host_driver_t        m_driver;
+    uint32_t             m_poll_interval_us;
+    uint8_t              m_endpoint_capacity;
+    bool                 m_use_queue;
+    uint32_t             m_now_us        = 0;
+    uint32_t             m_next_poll_us  = 0;
+    uint32_t             m_last_scan_us  = 0;
+    uint32_t             m_idle_us       = 0;
+    uint32_t             m_last_rx_us    = 0;
+    report_queue_t       m_queue         = {};
+    std::deque<uint32_t> m_queue_sent_us;
+    std::deque<Pending>  m_endpoint;
+    report_queue_entry_t m_last_sent     = {};
+    report_queue_entry_t m_last_received = {};
+    std::vector<Report>  m_received;
+    Statistics           m_stats = {};
+
+    static TestUsbHost* m_this;
+};
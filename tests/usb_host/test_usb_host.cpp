@@ -0,0 +1,186 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_usb_host.hpp"
+
+class UsbHost : public TestFixture {
+   protected:
+    std::vector<KeymapKey> keys;
+
+    void SetUp() override {
+        for (uint8_t col = 0; col < 6; col++) {
+            keys.push_back(KeymapKey(0, col, 0, KC_A + col));
+        }
+        set_keymap({keys[0], keys[1], keys[2], keys[3], keys[4], keys[5]});
+    }
+
+    /* Press all keys and release them again, one key per scan loop */
+    void rollover() {
+        for (auto& key : keys) {
+            key.press();
+            run_one_scan_loop();
+        }
+        for (auto& key : keys) {
+            key.release();
+            run_one_scan_loop();
+        }
+    }
+
+    /* Tap every key, with one scan loop each for the press and the release */
+    void fast_taps(int rounds) {
+        for (int i = 0; i < rounds; i++) {
+            for (auto& key : keys) {
+                key.press();
+                run_one_scan_loop();
+                key.release();
+                run_one_scan_loop();
+            }
+        }
+    }
+};
+
+TEST_F(UsbHost, FullSpeedReceivesEveryReport) {
+    TestUsbHost host(1000);
+
+    rollover();
+    idle_for(10);
+
+    auto& stats = host.statistics();
+    EXPECT_EQ(stats.received, stats.sent);
+    EXPECT_EQ(stats.stalls, 0);
+    EXPECT_LE(stats.max_latency_us, 1000);
+    EXPECT_EQ(stats.presses_sent, 6);
+    EXPECT_EQ(host.lost_presses(), 0);
+}
+
+TEST_F(UsbHost, HighSpeedPollsWithinMicroseconds) {
+    TestUsbHost host(125);
+
+    rollover();
+    idle_for(10);
+
+    EXPECT_EQ(host.statistics().stalls, 0);
+    EXPECT_LE(host.statistics().max_latency_us, 125);
+    EXPECT_EQ(host.lost_presses(), 0);
+}
+
+TEST_F(UsbHost, SlowPollingStallsTheSender) {
+    TestUsbHost host(8000);
+
+    fast_taps(2);
+    idle_for(200);
+
+    auto& stats = host.statistics();
+    EXPECT_GT(stats.stalls, 0);
+    EXPECT_GT(stats.stalled_us, 0);
+    EXPECT_GT(stats.max_latency_us, 8000);
+    /* Blocking the sender doesn't lose anything, it just delays the keyboard */
+    EXPECT_EQ(stats.received, stats.sent);
+    EXPECT_EQ(host.lost_presses(), 0);
+}
+
+TEST_F(UsbHost, ReportQueueNeverStalls) {
+    TestUsbHost host(8000, 4, true);
+
+    rollover();
+    idle_for(100);
+
+    auto& stats = host.statistics();
+    EXPECT_EQ(stats.stalls, 0);
+    /* Presses are merged into fewer reports without the host missing any */
+    EXPECT_LT(stats.received, stats.sent);
+    EXPECT_GT(host.report_queue_statistics().coalesced, 0);
+    EXPECT_EQ(host.report_queue_statistics().dropped, 0);
+    EXPECT_EQ(host.lost_presses(), 0);
+}
+
+TEST_F(UsbHost, ReportQueueKeepsFastTaps) {
+    TestUsbHost host(8000, 4, true);
+
+    /* Taps can't be merged, so every report is queued in order */
+    fast_taps(1);
+    idle_for(200);
+
+    EXPECT_EQ(host.statistics().stalls, 0);
+    EXPECT_EQ(host.lost_presses(), 0);
+    EXPECT_EQ(host.report_queue_statistics().dropped, 0);
+    EXPECT_GT(host.report_queue_statistics().high_water, 0);
+}
+
+TEST_F(UsbHost, ReportQueueOverflowLosesTaps) {
+    TestUsbHost host(8000, 1, true);
+
+    fast_taps(3);
+    idle_for(200);
+
+    EXPECT_EQ(host.statistics().stalls, 0);
+    EXPECT_EQ(host.report_queue_statistics().high_water, REPORT_QUEUE_DEPTH);
+    EXPECT_GT(host.report_queue_statistics().dropped, 0);
+    EXPECT_GT(host.lost_presses(), 0);
+
+    /* The host still ends up with every key released */
+    auto& last = host.received().back().report;
+    EXPECT_EQ(last.kind, REPORT_QUEUE_KEYBOARD);
+    report_keyboard_t empty = {};
+    EXPECT_EQ(*(report_keyboard_t*)last.data, empty);
+}
+
+TEST_F(UsbHost, ReportQueueKindSwitchKeepsTheSentBaseline) {
+    report_queue_t    queue    = {};
+    report_keyboard_t released = {};
+    report_keyboard_t pressed  = {};
+    pressed.keys[0]            = KC_A;
+
+    /* Taps can't be merged, so they fill up the queue */
+    for (uint8_t i = 0; i < REPORT_QUEUE_DEPTH; i++) {
+        EXPECT_TRUE(report_queue_push(&queue, REPORT_QUEUE_KEYBOARD, i % 2 ? &released : &pressed, sizeof(report_keyboard_t)));
+    }
+    ASSERT_EQ(queue.count, REPORT_QUEUE_DEPTH);
+
+    /* Switching to NKRO on a full queue drops the oldest report, which the
+     * host never saw, so it must not become the baseline */
+    EXPECT_TRUE(report_queue_push(&queue, REPORT_QUEUE_NKRO, &released, sizeof(report_keyboard_t)));
+    EXPECT_EQ(queue.stats.dropped, 1);
+    EXPECT_EQ(queue.last.size, 0);
+
+    report_queue_pop(&queue);
+    EXPECT_EQ(queue.last.size, sizeof(report_keyboard_t));
+    EXPECT_EQ(std::memcmp(queue.last.data, &released, sizeof(report_keyboard_t)), 0);
+}
+
+TEST_F(UsbHost, IdleRateRepeatsTheLastReport) {
+    TestUsbHost host(1000);
+    host.set_idle(2);
+
+    keys[0].press();
+    run_one_scan_loop();
+    idle_for(40);
+
+    auto& report = host.get_report();
+    EXPECT_EQ(((report_keyboard_t*)report.data)->keys[0], KC_A);
+    EXPECT_GE(host.statistics().idle_repeats, 4);
+    EXPECT_EQ(host.statistics().presses_received, 1);
+
+    keys[0].release();
+    run_one_scan_loop();
+    idle_for(10);
+}
+
+TEST_F(UsbHost, NoIdleReportsByDefault) {
+    TestUsbHost host(1000);
+
+    keys[0].press();
+    run_one_scan_loop();
+    idle_for(40);
+
+    EXPECT_EQ(host.statistics().idle_repeats, 0);
+    EXPECT_EQ(host.statistics().received, 1);
+
+    keys[0].release();
+    run_one_scan_loop();
+    idle_for(10);
+}
@@ -46,6 +46,11 @@ ifeq ($(strip $(NKRO_ENABLE)), yes)
     SHARED_EP_ENABLE = yes
 endif
 
+ifeq ($(strip $(USB_REPORT_QUEUE_ENABLE)), yes)
+    OPT_DEFS += -DUSB_REPORT_QUEUE_ENABLE
+    SRC += $(PROTOCOL_DIR)/report_queue.c
+endif
+
 ifeq ($(strip $(NO_SUSPEND_POWER_DOWN)), yes)
     OPT_DEFS += -DNO_SUSPEND_POWER_DOWN
 endif
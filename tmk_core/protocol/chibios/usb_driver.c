@@ -310,6 +310,16 @@ void usb_endpoint_in_flush(usb_endpoint_in_t *endpoint, bool padded) {
     obqFlush(obqp);
 }
 
+bool usb_endpoint_in_is_full(usb_endpoint_in_t *endpoint) {
+    osalDbgCheck(endpoint != NULL);
+
+    osalSysLock();
+    bool full = obqIsFullI(&endpoint->obqueue);
+    osalSysUnlock();
+
+    return full;
+}
+
 bool usb_endpoint_in_is_inactive(usb_endpoint_in_t *endpoint) {
     osalDbgCheck(endpoint != NULL);
 
@@ -32,6 +32,10 @@
 #    include "raw_hid.h"
 #endif
 
+#ifdef USB_REPORT_QUEUE_ENABLE
+#    include "report_queue.h"
+#endif
+
 #ifdef NKRO_ENABLE
 #    include "keycode_config.h"
 
@@ -379,9 +383,14 @@ __attribute__((weak)) void restart_usb_driver(USBDriver *usbp) {
  * ---------------------------------------------------------
  */
 
+#ifdef USB_REPORT_QUEUE_ENABLE
+static void report_queue_drain(usb_endpoint_in_lut_t endpoint);
+#endif
+
 /**
  * @brief Send a report to the host, the report is enqueued into an output
- * queue and send once the USB endpoint becomes empty.
+ * queue and send once the USB endpoint becomes empty. Reports still waiting
+ * in the report queue of the same endpoint are sent first.
  *
  * @param endpoint USB IN endpoint to send the report from
  * @param report pointer to the report
@@ -390,6 +399,9 @@ __attribute__((weak)) void restart_usb_driver(USBDriver *usbp) {
  * @return false Failure
  */
 bool send_report(usb_endpoint_in_lut_t endpoint, void *report, size_t size) {
+#ifdef USB_REPORT_QUEUE_ENABLE
+    report_queue_drain(endpoint);
+#endif
     return usb_endpoint_in_send(&usb_endpoints_in[endpoint], (uint8_t *)report, size, TIME_MS2I(100), false);
 }
 
@@ -434,18 +446,124 @@ static bool receive_report(usb_endpoint_out_lut_t endpoint, void *report, size_t
     return usb_endpoint_out_receive(&usb_endpoints_out[endpoint], (uint8_t *)report, size, TIME_IMMEDIATE);
 }
 
+#ifdef USB_REPORT_QUEUE_ENABLE
+
+static report_queue_t keyboard_report_queue;
+#    if defined(NKRO_ENABLE) && !defined(KEYBOARD_SHARED_EP)
+static report_queue_t nkro_report_queue;
+#    else
+/* The NKRO and keyboard reports go out on the same endpoint, so they share a
+ * queue to keep their order. */
+#        define nkro_report_queue keyboard_report_queue
+#    endif
+
+static report_queue_t *report_queue_for(usb_endpoint_in_lut_t endpoint) {
+    if (endpoint == USB_ENDPOINT_IN_KEYBOARD) {
+        return &keyboard_report_queue;
+    }
+#    ifdef NKRO_ENABLE
+    if (endpoint == USB_ENDPOINT_IN_SHARED) {
+        return &nkro_report_queue;
+    }
+#    endif
+    return NULL;
+}
+
+/**
+ * @brief Move queued reports into the endpoint as long as it has free
+ * buffers, so that sending never blocks. Reports queued while the device is
+ * not active are discarded, like `send_report` does.
+ */
+static void report_queue_flush(usb_endpoint_in_lut_t endpoint, report_queue_t *queue) {
+    if (usbGetDriverStateI(&USB_DRIVER) != USB_ACTIVE) {
+        report_queue_clear(queue);
+        return;
+    }
+
+    const report_queue_entry_t *entry;
+    while ((entry = report_queue_peek(queue)) != NULL && !usb_endpoint_in_is_full(&usb_endpoints_in[endpoint])) {
+        /* a report that didn't make it into the endpoint stays queued */
+        if (!usb_endpoint_in_send(&usb_endpoints_in[endpoint], (uint8_t *)entry->data, entry->size, TIME_MS2I(100), false)) {
+            break;
+        }
+        report_queue_pop(queue);
+    }
+}
+
+/**
+ * @brief Move all queued reports of an endpoint into it, blocking like
+ * `send_report` does. Every other report sent on the endpoint, like extra keys
+ * or mouse reports on the shared endpoint, goes through here first, so it
+ * can't overtake the keyboard reports queued before it.
+ */
+static void report_queue_drain(usb_endpoint_in_lut_t endpoint) {
+    report_queue_t *queue = report_queue_for(endpoint);
+    if (queue == NULL || report_queue_is_empty(queue)) {
+        return;
+    }
+    if (usbGetDriverStateI(&USB_DRIVER) != USB_ACTIVE) {
+        report_queue_clear(queue);
+        return;
+    }
+
+    const report_queue_entry_t *entry;
+    while ((entry = report_queue_peek(queue)) != NULL) {
+        /* a report that times out is lost, as it would have been without the queue */
+        usb_endpoint_in_send(&usb_endpoints_in[endpoint], (uint8_t *)entry->data, entry->size, TIME_MS2I(100), false);
+        report_queue_pop(queue);
+    }
+}
+
+static void send_report_queued(usb_endpoint_in_lut_t endpoint, report_queue_kind_t kind, void *report, size_t size) {
+    report_queue_t *queue = report_queue_for(endpoint);
+
+    report_queue_push(queue, kind, report, size);
+    report_queue_flush(endpoint, queue);
+}
+
+void usb_report_queue_task(void) {
+    report_queue_flush(USB_ENDPOINT_IN_KEYBOARD, &keyboard_report_queue);
+#    if defined(NKRO_ENABLE) && !defined(KEYBOARD_SHARED_EP)
+    report_queue_flush(USB_ENDPOINT_IN_SHARED, &nkro_report_queue);
+#    endif
+}
+
+bool usb_report_queue_get_stats(usb_endpoint_in_lut_t endpoint, report_queue_stats_t *stats) {
+    report_queue_t *queue = report_queue_for(endpoint);
+    if (queue == NULL) {
+        return false;
+    }
+
+    *stats = queue->stats;
+    return true;
+}
+
+#endif // USB_REPORT_QUEUE_ENABLE
+
 void send_keyboard(report_keyboard_t *report) {
+    void  *data = report;
+    size_t size = KEYBOARD_REPORT_SIZE;
+
     /* If we're in Boot Protocol, don't send any report ID or other funky fields */
     if (usb_device_state_get_protocol() == USB_PROTOCOL_BOOT) {
-        send_report(USB_ENDPOINT_IN_KEYBOARD, &report->mods, 8);
-    } else {
-        send_report(USB_ENDPOINT_IN_KEYBOARD, report, KEYBOARD_REPORT_SIZE);
+        data = &report->mods;
+        size = 8;
     }
+
+#ifdef USB_REPORT_QUEUE_ENABLE
+    send_report_queued(USB_ENDPOINT_IN_KEYBOARD, REPORT_QUEUE_KEYBOARD, data, size);
+#else
+    send_report(USB_ENDPOINT_IN_KEYBOARD, data, size);
+#endif
 }
 
 void send_nkro(report_nkro_t *report) {
 #ifdef NKRO_ENABLE
+#    ifdef USB_REPORT_QUEUE_ENABLE
+    send_report_queued(USB_ENDPOINT_IN_SHARED, REPORT_QUEUE_NKRO, report, sizeof(report_nkro_t));
+#    else
     send_report(USB_ENDPOINT_IN_SHARED, report, sizeof(report_nkro_t));
+#    endif
 #endif
 }
 
@@ -34,6 +34,23 @@ void restart_usb_driver(USBDriver *usbp);
 
 bool send_report(usb_endpoint_in_lut_t endpoint, void *report, size_t size);
 
+/* ----------------
+ * USB Report queue
+ * ----------------
+ */
+
+#ifdef USB_REPORT_QUEUE_ENABLE
+
+#    include "report_queue.h"
+
+/* Task to move queued keyboard reports into their endpoints */
+void usb_report_queue_task(void);
+
+/* Statistics of the report queue of an endpoint, false if it has no queue */
+bool usb_report_queue_get_stats(usb_endpoint_in_lut_t endpoint, report_queue_stats_t *stats);
+
+#endif
+
 /* ---------------
  * USB Event queue
  * ---------------
@@ -0,0 +1,154 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+
+#include "report_queue.h"
+#include "compiler_support.h"
+
+STATIC_ASSERT(REPORT_QUEUE_DEPTH > 0 && REPORT_QUEUE_DEPTH <= UINT8_MAX, "REPORT_QUEUE_DEPTH must be between 1 and 255");
+
+void report_queue_clear(report_queue_t *queue) {
+    queue->head      = 0;
+    queue->count     = 0;
+    queue->last.size = 0;
+}
+
+static inline report_queue_entry_t *entry_at(report_queue_t *queue, uint8_t index) {
+    return &queue->entries[(queue->head + index) % REPORT_QUEUE_DEPTH];
+}
+
+/* Forget the oldest report without sending it, so `last` still is the
+ * report the host received last. */
+static void drop_oldest(report_queue_t *queue) {
+    queue->head  = (queue->head + 1) % REPORT_QUEUE_DEPTH;
+    queue->count = queue->count - 1;
+}
+
+static inline bool same_report(const report_queue_entry_t *entry, report_queue_kind_t kind, const uint8_t *report, uint8_t size) {
+    return entry->size == size && entry->kind == kind && memcmp(entry->data, report, size) == 0;
+}
+
+static bool has_key(const uint8_t *keys, uint8_t key) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (keys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Whether `above` can replace `below` without the host missing a key
+ * that `below` pressed or released relative to `base`.
+ *
+ * For bitmaps this is the case if no bit changes both from `base` to `below`
+ * and from `below` to `above`.
+ */
+static bool can_merge(const report_queue_entry_t *base, const report_queue_entry_t *below, const uint8_t *above, uint8_t size) {
+    if (base->size != size || base->kind != below->kind) {
+        return false;
+    }
+
+    uint8_t bitmap_start = 1;
+    uint8_t bitmap_end   = size;
+
+    if (below->kind == REPORT_QUEUE_KEYBOARD) {
+        /* an optional report ID, then mods, reserved and the keys */
+        uint8_t mods = size - 2 - KEYBOARD_REPORT_KEYS;
+        if ((base->data[mods] ^ below->data[mods]) & (below->data[mods] ^ above[mods])) {
+            return false;
+        }
+
+        const uint8_t *base_keys  = &base->data[mods + 2];
+        const uint8_t *below_keys = &below->data[mods + 2];
+        const uint8_t *above_keys = &above[mods + 2];
+        for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+            /* pressed and released again */
+            if (below_keys[i] && !has_key(base_keys, below_keys[i]) && !has_key(above_keys, below_keys[i])) {
+                return false;
+            }
+            /* released and pressed again */
+            if (base_keys[i] && !has_key(below_keys, base_keys[i]) && has_key(above_keys, base_keys[i])) {
+                return false;
+            }
+        }
+
+        bitmap_end = 0;
+    }
+
+    for (uint8_t i = bitmap_start; i < bitmap_end; i++) {
+        if ((base->data[i] ^ below->data[i]) & (below->data[i] ^ above[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool report_queue_push(report_queue_t *queue, report_queue_kind_t kind, const void *report, uint8_t size) {
+    if (size > REPORT_QUEUE_REPORT_SIZE) {
+        return false;
+    }
+
+    queue->stats.enqueued++;
+
+    report_queue_entry_t *tail = queue->count ? entry_at(queue, queue->count - 1) : NULL;
+
+    /* nothing changed since the last report */
+    if (same_report(tail ? tail : &queue->last, kind, report, size)) {
+        queue->stats.coalesced++;
+        return false;
+    }
+
+    if (tail && tail->kind == kind && tail->size == size) {
+        const report_queue_entry_t *base = queue->count > 1 ? entry_at(queue, queue->count - 2) : &queue->last;
+
+        if (can_merge(base, tail, report, size)) {
+            memcpy(tail->data, report, size);
+            queue->stats.coalesced++;
+            return true;
+        }
+
+        /* out of space: keep the latest state and lose the intermediate one */
+        if (queue->count == REPORT_QUEUE_DEPTH) {
+            memcpy(tail->data, report, size);
+            queue->stats.dropped++;
+            return true;
+        }
+    }
+
+    if (queue->count == REPORT_QUEUE_DEPTH) {
+        /* only reachable when switching between 6KRO and NKRO on a full
+         * queue, where the oldest report is least relevant */
+        drop_oldest(queue);
+        queue->stats.dropped++;
+    }
+
+    report_queue_entry_t *entry = entry_at(queue, queue->count++);
+    entry->kind                 = kind;
+    entry->size                 = size;
+    memcpy(entry->data, report, size);
+
+    if (queue->count > queue->stats.high_water) {
+        queue->stats.high_water = queue->count;
+    }
+
+    return true;
+}
+
+const report_queue_entry_t *report_queue_peek(const report_queue_t *queue) {
+    if (queue->count == 0) {
+        return NULL;
+    }
+    return &queue->entries[queue->head];
+}
+
+void report_queue_pop(report_queue_t *queue) {
+    if (queue->count == 0) {
+        return;
+    }
+
+    queue->last = queue->entries[queue->head];
+    drop_oldest(queue);
+}
@@ -0,0 +1,94 @@
+// Copyright 2025 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "report.h"
+
+#ifndef REPORT_QUEUE_DEPTH
+#    define REPORT_QUEUE_DEPTH 4
+#endif
+
+#ifdef NKRO_ENABLE
+#    define REPORT_QUEUE_REPORT_SIZE sizeof(report_nkro_t)
+#else
+#    define REPORT_QUEUE_REPORT_SIZE sizeof(report_keyboard_t)
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    /* 6KRO keyboard report, optionally prefixed by its report ID */
+    REPORT_QUEUE_KEYBOARD,
+    /* NKRO keyboard report, a report ID followed by a bitmap */
+    REPORT_QUEUE_NKRO,
+} report_queue_kind_t;
+
+typedef struct {
+    uint8_t kind;
+    uint8_t size;
+    uint8_t data[REPORT_QUEUE_REPORT_SIZE];
+} report_queue_entry_t;
+
+typedef struct {
+    /* reports handed to the queue */
+    uint32_t enqueued;
+    /* reports merged into a queued report, or dropped as unchanged */
+    uint32_t coalesced;
+    /* reports that had to be merged into a full queue, losing a press or release */
+    uint32_t dropped;
+    /* highest number of reports waiting at once */
+    uint8_t high_water;
+} report_queue_stats_t;
+
+typedef struct {
+    report_queue_entry_t entries[REPORT_QUEUE_DEPTH];
+    /* the report that was last taken out of the queue, the reference for coalescing */
+    report_queue_entry_t last;
+    uint8_t              head;
+    uint8_t              count;
+    report_queue_stats_t stats;
+} report_queue_t;
+
+/**
+ * @brief Empty the queue and forget the last report, keeping the statistics.
+ */
+void report_queue_clear(report_queue_t *queue);
+
+/**
+ * @brief Add a report to the queue, never blocks.
+ *
+ * A report that is state-equivalent to the previous one is dropped. A report
+ * is merged into the last queued report as long as that doesn't hide a press
+ * or release from the host. Only if the queue is full a key change is lost,
+ * the queue always ends in the latest state though.
+ *
+ * @return true if the report is waiting in the queue, false if it was dropped
+ * as unchanged
+ */
+bool report_queue_push(report_queue_t *queue, report_queue_kind_t kind, const void *report, uint8_t size);
+
+/**
+ * @brief The oldest report in the queue, NULL if the queue is empty.
+ */
+const report_queue_entry_t *report_queue_peek(const report_queue_t *queue);
+
+/**
+ * @brief Remove the oldest report from the queue, once it was handed to the
+ * endpoint. It becomes the reference for coalescing later reports.
+ */
+void report_queue_pop(report_queue_t *queue);
+
+static inline bool report_queue_is_empty(const report_queue_t *queue) {
+    return queue->count == 0;
+}
+
+#ifdef __cplusplus
+}
+#endif